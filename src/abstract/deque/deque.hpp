@@ -4,7 +4,9 @@
 #include <memory>
 #include <stdexcept>
 
-template <typename T, typename Alloc = std::allocator<T>>
+#include "../../common/bounds_policy.hpp"
+
+template <typename T, typename Alloc = std::allocator<T>, typename BoundsPolicy = CheckedBounds>
 class Deque {
 private:
     static const size_t CHUNK_SIZE = 4;
@@ -225,16 +227,22 @@ public:
     }
 
     T& operator[](size_t index) {
-        if (index < 0 || index >= size_) {
-            throw std::out_of_range("Index out of range");
-        }
+        BoundsPolicy::Check(index, size_, "Index out of range");
         return ChunkElement(start_ + index);
     }
 
     const T& operator[](size_t index) const {
-        if (index < 0 || index >= size_) {
-            throw std::out_of_range("Index out of range");
-        }
+        BoundsPolicy::Check(index, size_, "Index out of range");
+        return ChunkElement(start_ + index);
+    }
+
+    T& At(size_t index) {
+        CheckedBounds::Check(index, size_, "Index out of range");
+        return ChunkElement(start_ + index);
+    }
+
+    const T& At(size_t index) const {
+        CheckedBounds::Check(index, size_, "Index out of range");
         return ChunkElement(start_ + index);
     }
 
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+
+// Policies deciding what indexed access does with an out of range position.
+// At() stays checked whatever policy the container uses.
+struct CheckedBounds {
+    static void Check(size_t pos, size_t size, const char* message) {
+        if (pos >= size) {
+            throw std::out_of_range(message);
+        }
+    }
+};
+
+struct AssertBounds {
+    static void Check([[maybe_unused]] size_t pos, [[maybe_unused]] size_t size,
+                      [[maybe_unused]] const char* message) noexcept {
+        assert(pos < size && message);
+    }
+};
+
+struct UncheckedBounds {
+    static void Check(size_t, size_t, const char*) noexcept {
+    }
+};
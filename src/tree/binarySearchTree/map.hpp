@@ -2,32 +2,93 @@
 
 #include <fmt/core.h>
 
+#include <algorithm>
 #include <cstdlib>
+#include <cstdint>
 #include <functional>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "exceptions.hpp"
+#include "node_arena.hpp"
 
+// AVL tree: the heights of sibling subtrees differ by at most one, so sorted insertions
+// keep Find, Insert and Erase at O(log n) and the recursion depth logarithmic. Every node
+// also counts its subtree, which makes Size O(1) and the order statistics O(log n).
+// Nodes live in a NodeArena and link to each other through 32-bit handles.
 template <typename Key, typename Value, typename Compare = std::less<Key>>
 class Map {
 public:
-    Map() : root_(nullptr) {
+    Map() : root_(NIL) {
+    }
+
+    Map(Map&& other) noexcept : Map() {
+        Swap(other);
+    }
+
+    Map& operator=(Map&& other) noexcept {
+        Map moved(std::move(other));
+        Swap(moved);
+        return *this;
     }
 
     Value& operator[](const Key& key) {
-        return FindOrInsert(root_, key)->value;
+        return nodes_[FindOrInsert(root_, key)].value;
     }
 
     bool IsEmpty() const noexcept {
-        return !root_;
+        return root_ == NIL;
     }
 
     size_t Size() const noexcept {
-        return Size(root_);
+        return SubtreeSize(root_);
+    }
+
+    // Number of keys less than key.
+    size_t Rank(const Key& key) const {
+        size_t rank = 0;
+        for (uint32_t node = root_; node != NIL;) {
+            if (comp_(nodes_[node].key, key)) {
+                rank += SubtreeSize(nodes_[node].left) + 1;
+                node = nodes_[node].right;
+            } else {
+                node = nodes_[node].left;
+            }
+        }
+        return rank;
+    }
+
+    // The k-th smallest entry, counting from zero.
+    std::pair<const Key, Value> Select(size_t k) const {
+        if (k >= Size()) {
+            throw std::out_of_range("Map select out of range");
+        }
+        uint32_t node = root_;
+        while (true) {
+            size_t left = SubtreeSize(nodes_[node].left);
+            if (k < left) {
+                node = nodes_[node].left;
+            } else if (k > left) {
+                k -= left + 1;
+                node = nodes_[node].right;
+            } else {
+                return {nodes_[node].key, nodes_[node].value};
+            }
+        }
+    }
+
+    // Number of keys in [lo, hi).
+    size_t CountRange(const Key& lo, const Key& hi) const {
+        if (!comp_(lo, hi)) {
+            return 0;
+        }
+        return Rank(hi) - Rank(lo);
     }
 
     void Swap(Map& a) {
+        nodes_.Swap(a.nodes_);
         std::swap(root_, a.root_);
         std::swap(comp_, a.comp_);
     }
@@ -52,9 +113,13 @@ public:
         root_ = Erase(root_, key);
     }
 
+    // With trivially destructible keys and values no node is visited: the slabs are simply released.
     void Clear() noexcept {
-        Clear(root_);
-        root_ = nullptr;
+        if constexpr (!std::is_trivially_destructible_v<Key> || !std::is_trivially_destructible_v<Value>) {
+            Destroy(root_);
+        }
+        nodes_.Clear();
+        root_ = NIL;
     }
 
     bool Find(const Key& key) const {
@@ -67,126 +132,178 @@ public:
 
 private:
     struct Node {
-        Node(const Key& k, const Value& v) : key(k), value(v), left(nullptr), right(nullptr) {
+        Node(const Key& k, const Value& v) : key(k), value(v), left(NIL), right(NIL), size(1), height(1) {
         }
 
         Key key;
         Value value;
-        Node* left;
-        Node* right;
+        uint32_t left;
+        uint32_t right;
+        uint32_t size;
+        uint8_t height;
     };
 
-    Node* root_;
+    static constexpr uint32_t NIL = NodeArena<Node>::NIL;
+
+    NodeArena<Node> nodes_;
+    uint32_t root_;
     Compare comp_;
 
-    Node* FindOrInsert(Node*& node, const Key& key) {
-        if (!node) {
-            node = new Node(key, Value{});
-            return node;
+    int Height(uint32_t node) const noexcept {
+        return node != NIL ? nodes_[node].height : 0;
+    }
+
+    size_t SubtreeSize(uint32_t node) const noexcept {
+        return node != NIL ? nodes_[node].size : 0;
+    }
+
+    void Update(uint32_t node) noexcept {
+        Node& n = nodes_[node];
+        n.height = static_cast<uint8_t>(1 + std::max(Height(n.left), Height(n.right)));
+        n.size = static_cast<uint32_t>(1 + SubtreeSize(n.left) + SubtreeSize(n.right));
+    }
+
+    uint32_t RotateRight(uint32_t node) noexcept {
+        uint32_t pivot = nodes_[node].left;
+        nodes_[node].left = nodes_[pivot].right;
+        nodes_[pivot].right = node;
+        Update(node);
+        Update(pivot);
+        return pivot;
+    }
+
+    uint32_t RotateLeft(uint32_t node) noexcept {
+        uint32_t pivot = nodes_[node].right;
+        nodes_[node].right = nodes_[pivot].left;
+        nodes_[pivot].left = node;
+        Update(node);
+        Update(pivot);
+        return pivot;
+    }
+
+    // Restores the AVL invariant at node after one of its subtrees changed height by one.
+    uint32_t Balance(uint32_t node) noexcept {
+        Update(node);
+        Node& n = nodes_[node];
+        int balance = Height(n.left) - Height(n.right);
+        if (balance > 1) {
+            if (Height(nodes_[n.left].left) < Height(nodes_[n.left].right)) {
+                n.left = RotateLeft(n.left);
+            }
+            return RotateRight(node);
         }
+        if (balance < -1) {
+            if (Height(nodes_[n.right].right) < Height(nodes_[n.right].left)) {
+                n.right = RotateRight(n.right);
+            }
+            return RotateLeft(node);
+        }
+        return node;
+    }
 
-        if (comp_(key, node->key)) {
-            return FindOrInsert(node->left, key);
-        } else if (comp_(node->key, key)) {
-            return FindOrInsert(node->right, key);
-        } else {
+    // Rotations relink nodes but never move them, so the returned handle stays valid.
+    uint32_t FindOrInsert(uint32_t& node, const Key& key) {
+        if (node == NIL) {
+            node = nodes_.Allocate(key, Value{});
             return node;
         }
-    }
 
-    size_t Size(Node* node) const noexcept {
-        if (!node) {
-            return 0;
+        uint32_t found;
+        if (comp_(key, nodes_[node].key)) {
+            found = FindOrInsert(nodes_[node].left, key);
+        } else if (comp_(nodes_[node].key, key)) {
+            found = FindOrInsert(nodes_[node].right, key);
+        } else {
+            return node;
         }
-        return 1 + Size(node->left) + Size(node->right);
+        node = Balance(node);
+        return found;
     }
 
-    void InOrderTraversal(Node* node, std::vector<std::pair<const Key, Value>>& values,
+    void InOrderTraversal(uint32_t node, std::vector<std::pair<const Key, Value>>& values,
                           bool is_increase) const noexcept {
-        if (!node) {
+        if (node == NIL) {
             return;
         }
+        const Node& n = nodes_[node];
         if (is_increase) {
-            InOrderTraversal(node->left, values, is_increase);
-            values.push_back({node->key, node->value});
-            InOrderTraversal(node->right, values, is_increase);
+            InOrderTraversal(n.left, values, is_increase);
+            values.push_back({n.key, n.value});
+            InOrderTraversal(n.right, values, is_increase);
         } else {
-            InOrderTraversal(node->right, values, is_increase);
-            values.push_back({node->key, node->value});
-            InOrderTraversal(node->left, values, is_increase);
+            InOrderTraversal(n.right, values, is_increase);
+            values.push_back({n.key, n.value});
+            InOrderTraversal(n.left, values, is_increase);
         }
     }
 
-    Node* Insert(Node* node, const std::pair<const Key, Value>& val) {
-        if (!node) {
-            return new Node(val.first, val.second);
+    uint32_t Insert(uint32_t node, const std::pair<const Key, Value>& val) {
+        if (node == NIL) {
+            return nodes_.Allocate(val.first, val.second);
         }
 
-        if (comp_(val.first, node->key)) {
-            node->left = Insert(node->left, val);
-        } else if (comp_(node->key, val.first)) {
-            node->right = Insert(node->right, val);
+        if (comp_(val.first, nodes_[node].key)) {
+            uint32_t left = Insert(nodes_[node].left, val);
+            nodes_[node].left = left;
+        } else if (comp_(nodes_[node].key, val.first)) {
+            uint32_t right = Insert(nodes_[node].right, val);
+            nodes_[node].right = right;
         } else {
-            node->value = val.second;
+            nodes_[node].value = val.second;
+            return node;
         }
 
-        return node;
+        return Balance(node);
     }
 
-    Node* Erase(Node* node, const Key& key) {
-        if (!node) {
+    uint32_t Erase(uint32_t node, const Key& key) {
+        if (node == NIL) {
             throw MapIsEmptyException("Error");
         }
 
-        if (comp_(key, node->key)) {
-            node->left = Erase(node->left, key);
-        } else if (comp_(node->key, key)) {
-            node->right = Erase(node->right, key);
+        Node& n = nodes_[node];
+        if (comp_(key, n.key)) {
+            n.left = Erase(n.left, key);
+        } else if (comp_(n.key, key)) {
+            n.right = Erase(n.right, key);
         } else {
-            if (!node->left && !node->right) {
-                delete node;
-                return nullptr;
-            } else if (!node->left) {
-                Node* temp = node->right;
-                delete node;
-                return temp;
-            } else if (!node->right) {
-                Node* temp = node->left;
-                delete node;
+            if (n.left == NIL || n.right == NIL) {
+                uint32_t temp = n.left != NIL ? n.left : n.right;
+                nodes_.Free(node);
                 return temp;
-            } else {
-                Node* successor = Minimum(node->right);
-                node->key = successor->key;
-                node->value = successor->value;
-                node->right = Erase(node->right, successor->key);
             }
+            const Node& successor = nodes_[Minimum(n.right)];
+            n.key = successor.key;
+            n.value = successor.value;
+            n.right = Erase(n.right, n.key);
         }
 
-        return node;
+        return Balance(node);
     }
 
-    Node* Minimum(Node* node) const noexcept {
-        while (node->left) {
-            node = node->left;
+    uint32_t Minimum(uint32_t node) const noexcept {
+        while (nodes_[node].left != NIL) {
+            node = nodes_[node].left;
         }
         return node;
     }
 
-    void Clear(Node* node) noexcept {
-        if (!node) {
+    // Runs the node destructors only; Clear then hands the slabs back in one go.
+    void Destroy(uint32_t node) noexcept {
+        if (node == NIL) {
             return;
         }
-        Clear(node->left);
-        Clear(node->right);
-        delete node;
+        Destroy(nodes_[node].left);
+        Destroy(nodes_[node].right);
+        nodes_[node].~Node();
     }
 
-    bool Find(Node* node, const Key& key) const {
-        while (node) {
-            if (comp_(key, node->key)) {
-                node = node->left;
-            } else if (comp_(node->key, key)) {
-                node = node->right;
+    bool Find(uint32_t node, const Key& key) const {
+        while (node != NIL) {
+            if (comp_(key, nodes_[node].key)) {
+                node = nodes_[node].left;
+            } else if (comp_(nodes_[node].key, key)) {
+                node = nodes_[node].right;
             } else {
                 return true;
             }
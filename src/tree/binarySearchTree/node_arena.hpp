@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Slab allocator handing out 32-bit handles instead of pointers. Slots are carved from
+// slabs of SLAB_SIZE objects that never move, so a reference stays valid until its slot is
+// freed. Freed slots are chained into a free list through their own storage, and Clear
+// returns whole slabs at once. Handle 0 is never allocated and serves as the null handle.
+template <typename T>
+class NodeArena {
+public:
+    static constexpr uint32_t NIL = 0;
+    static constexpr size_t SLAB_BITS = 10;
+    static constexpr size_t SLAB_SIZE = size_t(1) << SLAB_BITS;
+
+    static_assert(sizeof(T) >= sizeof(uint32_t), "Free slots store the next free handle in place");
+
+    NodeArena() : next_(1), free_head_(NIL) {
+    }
+
+    NodeArena(const NodeArena& other) = delete;
+
+    NodeArena& operator=(const NodeArena& other) = delete;
+
+    NodeArena(NodeArena&& other) noexcept : NodeArena() {
+        Swap(other);
+    }
+
+    NodeArena& operator=(NodeArena&& other) noexcept {
+        NodeArena moved(std::move(other));
+        Swap(moved);
+        return *this;
+    }
+
+    T& operator[](uint32_t handle) noexcept {
+        return slabs_[handle >> SLAB_BITS][handle & (SLAB_SIZE - 1)];
+    }
+
+    const T& operator[](uint32_t handle) const noexcept {
+        return slabs_[handle >> SLAB_BITS][handle & (SLAB_SIZE - 1)];
+    }
+
+    // If T's constructor throws, the slot is left free again and no handle is consumed.
+    template <class... Args>
+    uint32_t Allocate(Args&&... args) {
+        uint32_t handle = free_head_;
+        uint32_t next_free = NIL;
+        if (handle != NIL) {
+            next_free = *reinterpret_cast<uint32_t*>(Slot(handle));
+        } else {
+            if (next_ == UINT32_MAX) {
+                throw std::length_error("NodeArena handles exhausted");
+            }
+            if ((next_ >> SLAB_BITS) == slabs_.size()) {
+                slabs_.reserve(slabs_.size() + 1);
+                slabs_.push_back(allocator_.allocate(SLAB_SIZE));
+            }
+            handle = next_;
+        }
+        try {
+            new (Slot(handle)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            if (free_head_ != NIL) {
+                *reinterpret_cast<uint32_t*>(Slot(handle)) = next_free;
+            }
+            throw;
+        }
+        if (free_head_ != NIL) {
+            free_head_ = next_free;
+        } else {
+            ++next_;
+        }
+        return handle;
+    }
+
+    void Free(uint32_t handle) noexcept {
+        (*this)[handle].~T();
+        *reinterpret_cast<uint32_t*>(Slot(handle)) = free_head_;
+        free_head_ = handle;
+    }
+
+    // Releases every slab without running destructors; live objects must be destroyed first.
+    void Clear() noexcept {
+        for (T* slab : slabs_) {
+            allocator_.deallocate(slab, SLAB_SIZE);
+        }
+        slabs_.clear();
+        next_ = 1;
+        free_head_ = NIL;
+    }
+
+    size_t SlabCount() const noexcept {
+        return slabs_.size();
+    }
+
+    void Swap(NodeArena& other) noexcept {
+        std::swap(slabs_, other.slabs_);
+        std::swap(next_, other.next_);
+        std::swap(free_head_, other.free_head_);
+    }
+
+    ~NodeArena() {
+        Clear();
+    }
+
+private:
+    void* Slot(uint32_t handle) const noexcept {
+        return slabs_[handle >> SLAB_BITS] + (handle & (SLAB_SIZE - 1));
+    }
+
+    std::allocator<T> allocator_;
+    std::vector<T*> slabs_;
+    uint32_t next_;
+    uint32_t free_head_;
+};
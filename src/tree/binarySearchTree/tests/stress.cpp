@@ -45,6 +45,18 @@ void ConstructLinearMap(std::map<int, int>& mp, int sz) {
   }
 }
 
+void ConstructSortedMap(Map<int, int>& mp, int sz) {
+  for (int key = 0; key < sz; ++key) {
+    mp.Insert(std::pair{key, 1});
+  }
+}
+
+void ConstructSortedMap(std::map<int, int>& mp, int sz) {
+  for (int key = 0; key < sz; ++key) {
+    mp.insert(std::pair{key, 1});
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 void BM_CustomMapRandomInsert(benchmark::State& state) {
   Map<int, int> mp;
@@ -78,6 +90,97 @@ void BM_StdMapLinearInsert(benchmark::State& state) {
   state.SetComplexityN(state.range(0));
 }
 
+void BM_CustomMapSortedInsert(benchmark::State& state) {
+  for (auto _ : state) {
+    Map<int, int> mp;
+    ConstructSortedMap(mp, state.range(0));
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_StdMapSortedInsert(benchmark::State& state) {
+  for (auto _ : state) {
+    std::map<int, int> mp;
+    ConstructSortedMap(mp, state.range(0));
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_CustomMapSortedFind(benchmark::State& state) {
+  Map<int, int> mp;
+  ConstructSortedMap(mp, state.range(0));
+  for (auto _ : state) {
+    for (int key = 0; key < state.range(0); ++key) {
+      benchmark::DoNotOptimize(mp.Find(key));
+    }
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_StdMapSortedFind(benchmark::State& state) {
+  std::map<int, int> mp;
+  ConstructSortedMap(mp, state.range(0));
+  for (auto _ : state) {
+    for (int key = 0; key < state.range(0); ++key) {
+      benchmark::DoNotOptimize(mp.find(key));
+    }
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_CustomMapSize(benchmark::State& state) {
+  Map<int, int> mp;
+  ConstructRandomMap(mp, state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mp.Size());
+  }
+}
+
+void BM_CustomMapSelectPercentiles(benchmark::State& state) {
+  Map<int, int> mp;
+  ConstructRandomMap(mp, state.range(0));
+  for (auto _ : state) {
+    for (int percentile = 1; percentile < 100; ++percentile) {
+      benchmark::DoNotOptimize(mp.Select(mp.Size() * percentile / 100).first);
+    }
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_CustomMapValuesPercentiles(benchmark::State& state) {
+  Map<int, int> mp;
+  ConstructRandomMap(mp, state.range(0));
+  for (auto _ : state) {
+    auto values = mp.Values();
+    for (int percentile = 1; percentile < 100; ++percentile) {
+      benchmark::DoNotOptimize(values[values.size() * percentile / 100].first);
+    }
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_CustomMapTeardown(benchmark::State& state) {
+  Map<int, int> mp;
+  for (auto _ : state) {
+    state.PauseTiming();
+    ConstructSortedMap(mp, state.range(0));
+    state.ResumeTiming();
+    mp.Clear();
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_StdMapTeardown(benchmark::State& state) {
+  std::map<int, int> mp;
+  for (auto _ : state) {
+    state.PauseTiming();
+    ConstructSortedMap(mp, state.range(0));
+    state.ResumeTiming();
+    mp.clear();
+  }
+  state.SetComplexityN(state.range(0));
+}
+
 void BM_CustomMapErase(benchmark::State& state) {
   Map<int, int> mp;
   std::random_device rd;
@@ -135,8 +238,17 @@ void BM_StdMapClear(benchmark::State& state) {
 
 BENCHMARK(BM_CustomMapRandomInsert)->Range(1<<10, 1<<20)->Complexity()->Unit(benchmark::kMillisecond);
 BENCHMARK(BM_StdMapRandomInsert)->Range(1<<10, 1<<20)->Complexity()->Unit(benchmark::kMillisecond);
-BENCHMARK(BM_CustomMapLinearInsert)->Range(1<<10, 1<<15)->Complexity()->Unit(benchmark::kMillisecond);
-BENCHMARK(BM_StdMapLinearInsert)->Range(1<<10, 1<<15)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CustomMapLinearInsert)->Range(1<<10, 1<<20)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_StdMapLinearInsert)->Range(1<<10, 1<<20)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CustomMapSortedInsert)->Range(1<<10, 1<<20)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_StdMapSortedInsert)->Range(1<<10, 1<<20)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CustomMapSortedFind)->Range(1<<10, 1<<20)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_StdMapSortedFind)->Range(1<<10, 1<<20)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CustomMapSize)->Range(1<<10, 1<<20);
+BENCHMARK(BM_CustomMapSelectPercentiles)->Range(1<<10, 1<<20)->Complexity()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CustomMapValuesPercentiles)->Range(1<<10, 1<<20)->Complexity()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CustomMapTeardown)->Range(1<<10, 1<<23)->Iterations(5)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_StdMapTeardown)->Range(1<<10, 1<<23)->Iterations(5)->Complexity()->Unit(benchmark::kMillisecond);
 BENCHMARK(BM_CustomMapErase)->Range(1<<10, 1<<17)->Complexity()->Unit(benchmark::kMillisecond);
 BENCHMARK(BM_StdMapErase)->Range(1<<10, 1<<17)->Complexity()->Unit(benchmark::kMillisecond);
 BENCHMARK(BM_CustomMapClear)->Range(1<<10, 1<<20)->Complexity()->Unit(benchmark::kMillisecond);
@@ -1,9 +1,11 @@
+#include <cmath>
 #include <chrono>
 #include <future>
 #include <map>
 #include <iostream>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <fmt/core.h>
 #include <gtest/gtest.h>
@@ -161,6 +163,134 @@ TEST(EmptyMapTest, StringAsKey) {
   }
 }
 
+TEST(EmptyMapTest, SortedInsertStaysBalanced) {
+  Map<int, int> map;
+  const int count = 1 << 20;
+  for (int i = 0; i < count; ++i) {
+    map[i] = i;
+  }
+  for (int i = count; i > 0; --i) {
+    map.Insert({-i, i});
+  }
+  for (int i = -count; i < count; i += 1021) {
+    ASSERT_TRUE(map.Find(i)) << fmt::format("Key {} not found", i);
+  }
+  for (int i = 0; i < count; i += 2) {
+    map.Erase(i);
+  }
+  ASSERT_FALSE(map.Find(2));
+  ASSERT_TRUE(map.Find(3));
+  auto values = map.Values();
+  ASSERT_EQ(values.size(), count + count / 2);
+  for (size_t i = 1; i < values.size(); ++i) {
+    ASSERT_LT(values[i - 1].first, values[i].first);
+  }
+}
+
+TEST_F(MapTest, OrderStatistics) {
+  auto values = mp.Values();
+  for (size_t k = 0; k < values.size(); ++k) {
+    auto entry = mp.Select(k);
+    ASSERT_EQ(entry.first, values[k].first);
+    ASSERT_EQ(entry.second, values[k].second);
+    ASSERT_EQ(mp.Rank(values[k].first), k);
+  }
+  ASSERT_THROW(mp.Select(sz), std::out_of_range);
+  ASSERT_EQ(mp.Rank(-100), 0);
+  ASSERT_EQ(mp.Rank(2), 3);
+  ASSERT_EQ(mp.Rank(1000), sz);
+  ASSERT_EQ(mp.CountRange(0, 10), 4);
+  ASSERT_EQ(mp.CountRange(-10, 91), sz);
+  ASSERT_EQ(mp.CountRange(10, 0), 0);
+
+  mp.Erase(3);
+  mp[4] = 1;
+  mp[5] = 2;
+  ASSERT_EQ(mp.Size(), sz);
+  ASSERT_EQ(mp.Select(3).first, 4);
+  mp.Clear();
+  ASSERT_EQ(mp.Size(), 0);
+}
+
+TEST(EmptyMapTest, NodeArenaReusesFreedSlots) {
+  NodeArena<std::string> arena;
+  uint32_t first = arena.Allocate("first");
+  uint32_t second = arena.Allocate(std::string(100, 's'));
+  ASSERT_NE(first, NodeArena<std::string>::NIL);
+  ASSERT_EQ(arena[second].size(), 100);
+  arena.Free(first);
+  ASSERT_EQ(arena.Allocate("again"), first) << "Freed slot must be reused!";
+  std::vector<uint32_t> handles;
+  for (size_t i = 0; i < 2 * NodeArena<std::string>::SLAB_SIZE; ++i) {
+    handles.push_back(arena.Allocate());
+  }
+  ASSERT_EQ(arena.SlabCount(), 3);
+  const NodeArena<std::string>& view = arena;
+  ASSERT_EQ(view[first], "again");
+  arena.Free(first);
+  arena.Free(second);
+  for (uint32_t handle : handles) {
+    arena.Free(handle);
+  }
+}
+
+TEST(EmptyMapTest, NodeArenaThrowingConstructor) {
+  struct Fragile {
+    explicit Fragile(int v) : value(v) {
+      if (v < 0) {
+        throw std::invalid_argument("negative");
+      }
+    }
+    int value;
+  };
+  NodeArena<Fragile> arena;
+  ASSERT_THROW(arena.Allocate(-1), std::invalid_argument);
+  uint32_t first = arena.Allocate(1);
+  ASSERT_EQ(first, 1) << "A failed construction must not consume a handle!";
+  uint32_t second = arena.Allocate(2);
+  arena.Free(first);
+  ASSERT_THROW(arena.Allocate(-1), std::invalid_argument);
+  ASSERT_EQ(arena.Allocate(3), first) << "A failed construction must keep the freed slot!";
+  ASSERT_EQ(arena[second].value, 2);
+  NodeArena<Fragile> moved(std::move(arena));
+  ASSERT_EQ(moved[first].value, 3);
+  ASSERT_EQ(arena.SlabCount(), 0);
+}
+
+TEST(EmptyMapTest, MoveMap) {
+  static_assert(std::is_nothrow_move_constructible_v<Map<int, std::string>>);
+  Map<int, std::string> map;
+  for (int i = 0; i < 100; ++i) {
+    map[i] = std::to_string(i);
+  }
+  Map<int, std::string> moved(std::move(map));
+  ASSERT_EQ(moved.Size(), 100);
+  ASSERT_TRUE(map.IsEmpty());
+  map[7] = "seven";
+  moved = std::move(map);
+  ASSERT_EQ(moved.Size(), 1);
+  ASSERT_TRUE(moved.Find(7));
+  std::vector<Map<int, std::string>> maps(3);
+  maps[0] = std::move(moved);
+  maps.resize(64);
+  ASSERT_EQ(maps[0].Size(), 1);
+}
+
+TEST(EmptyMapTest, ClearWithOwningValues) {
+  Map<int, std::string> map;
+  for (int i = 0; i < 5000; ++i) {
+    map[i] = std::string(64, 'v');
+  }
+  for (int i = 0; i < 5000; i += 3) {
+    map.Erase(i);
+  }
+  map.Clear();
+  ASSERT_TRUE(map.IsEmpty());
+  map[1] = "one";
+  ASSERT_EQ(map.Size(), 1);
+  ASSERT_EQ(map.Values()[0].second, "one");
+}
+
 TEST_F(MapTest, GetValueUsingOperator) {
   ASSERT_EQ(mp[5], 90);
   ASSERT_EQ(mp[-10], 5);
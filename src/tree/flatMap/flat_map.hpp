@@ -0,0 +1,150 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "../../vector/vector.hpp"
+#include "../binarySearchTree/exceptions.hpp"
+
+// Associative container with the Map interface stored as two sorted Vectors, one of keys
+// and one of values. Lookups binary search the contiguous keys without branching on the
+// comparison; Insert and Erase shift the tails, so it suits read-mostly tables.
+template <typename Key, typename Value, typename Compare = std::less<Key>>
+class FlatMap {
+public:
+    FlatMap() = default;
+
+    Value& operator[](const Key& key) {
+        size_t pos = LowerBound(key);
+        if (!Matches(pos, key)) {
+            InsertAt(pos, key, Value{});
+        }
+        return values_[pos];
+    }
+
+    bool IsEmpty() const noexcept {
+        return keys_.IsEmpty();
+    }
+
+    size_t Size() const noexcept {
+        return keys_.Size();
+    }
+
+    void Swap(FlatMap& a) {
+        std::swap(keys_, a.keys_);
+        std::swap(values_, a.values_);
+        std::swap(comp_, a.comp_);
+    }
+
+    std::vector<std::pair<const Key, Value>> Values(bool is_increase = true) const {
+        std::vector<std::pair<const Key, Value>> values;
+        values.reserve(Size());
+        for (size_t i = 0; i < Size(); ++i) {
+            size_t pos = is_increase ? i : Size() - 1 - i;
+            values.push_back({keys_.Data()[pos], values_.Data()[pos]});
+        }
+        return values;
+    }
+
+    void Insert(const std::initializer_list<std::pair<const Key, Value>>& values) {
+        for (const auto& val : values) {
+            Insert(val);
+        }
+    }
+
+    void Insert(const std::pair<const Key, Value>& val) {
+        size_t pos = LowerBound(val.first);
+        if (Matches(pos, val.first)) {
+            values_[pos] = val.second;
+        } else {
+            InsertAt(pos, val.first, val.second);
+        }
+    }
+
+    // Replaces the contents with [first, last), sorting once. Later duplicates win, as with Insert.
+    template <class InputIt>
+    void Build(InputIt first, InputIt last) {
+        std::vector<std::pair<Key, Value>> items(first, last);
+        std::stable_sort(items.begin(), items.end(),
+                         [this](const auto& a, const auto& b) { return comp_(a.first, b.first); });
+        Clear();
+        keys_.Reserve(items.size());
+        values_.Reserve(items.size());
+        for (size_t i = 0; i < items.size(); ++i) {
+            if (i + 1 < items.size() && !comp_(items[i].first, items[i + 1].first)) {
+                continue;
+            }
+            keys_.EmplaceBack(std::move(items[i].first));
+            values_.EmplaceBack(std::move(items[i].second));
+        }
+    }
+
+    void Build(const std::initializer_list<std::pair<const Key, Value>>& values) {
+        Build(values.begin(), values.end());
+    }
+
+    void Erase(const Key& key) {
+        size_t pos = LowerBound(key);
+        if (!Matches(pos, key)) {
+            throw MapIsEmptyException("FlatMap erase of missing key");
+        }
+        keys_.Erase(pos, pos + 1);
+        values_.Erase(pos, pos + 1);
+    }
+
+    void Clear() noexcept {
+        keys_.Clear();
+        values_.Clear();
+    }
+
+    bool Find(const Key& key) const {
+        return Matches(LowerBound(key), key);
+    }
+
+private:
+    // Keeps keys_ and values_ the same length if inserting the value throws.
+    void InsertAt(size_t pos, const Key& key, const Value& value) {
+        keys_.Insert(pos, key);
+        try {
+            values_.Insert(pos, value);
+        } catch (...) {
+            keys_.Erase(pos, pos + 1);
+            throw;
+        }
+    }
+
+    size_t LowerBound(const Key& key) const {
+        const Key* base = keys_.Data();
+        size_t count = keys_.Size();
+        if (count == 0) {
+            return 0;
+        }
+        while (count > 1) {
+            size_t half = count / 2;
+            base = comp_(base[half], key) ? base + half : base;
+            count -= half;
+        }
+        return static_cast<size_t>(base - keys_.Data()) + comp_(*base, key);
+    }
+
+    bool Matches(size_t pos, const Key& key) const {
+        return pos < keys_.Size() && !comp_(key, keys_.Data()[pos]);
+    }
+
+    Vector<Key> keys_;
+    Vector<Value> values_;
+    Compare comp_;
+};
+
+namespace std {
+// Global swap overloading
+template <typename Key, typename Value>
+// NOLINTNEXTLINE
+void swap(FlatMap<Key, Value>& a, FlatMap<Key, Value>& b) {
+    a.Swap(b);
+}
+}  // namespace std
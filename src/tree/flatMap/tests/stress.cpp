@@ -0,0 +1,104 @@
+#include <climits>
+#include <random>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <fmt/core.h>
+
+#include "../../../vector/vector.cpp"
+#include "../../binarySearchTree/map.hpp"
+#include "../flat_map.hpp"
+
+std::vector<std::pair<int, int>> RandomItems(int sz) {
+  std::mt19937 mt(42);
+  std::uniform_int_distribution<int> dist(INT_MIN, INT_MAX);
+  std::vector<std::pair<int, int>> items;
+  while(sz) {
+    items.push_back({dist(mt), 1});
+    --sz;
+  }
+  return items;
+}
+
+std::vector<int> RandomLookups(const std::vector<std::pair<int, int>>& items) {
+  std::mt19937 mt(7);
+  std::uniform_int_distribution<size_t> dist(0, items.size() - 1);
+  std::vector<int> keys;
+  for (size_t i = 0; i < items.size(); ++i) {
+    keys.push_back((i % 2) ? items[dist(mt)].first : static_cast<int>(mt()));
+  }
+  return keys;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void BM_FlatMapFind(benchmark::State& state) {
+  auto items = RandomItems(state.range(0));
+  auto keys = RandomLookups(items);
+  FlatMap<int, int> mp;
+  mp.Build(items.begin(), items.end());
+  for (auto _ : state) {
+    for (int key : keys) {
+      benchmark::DoNotOptimize(mp.Find(key));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+void BM_CustomMapFind(benchmark::State& state) {
+  auto items = RandomItems(state.range(0));
+  auto keys = RandomLookups(items);
+  Map<int, int> mp;
+  for (const auto& item : items) {
+    mp.Insert(item);
+  }
+  for (auto _ : state) {
+    for (int key : keys) {
+      benchmark::DoNotOptimize(mp.Find(key));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+void BM_StdMapFind(benchmark::State& state) {
+  auto items = RandomItems(state.range(0));
+  auto keys = RandomLookups(items);
+  std::map<int, int> mp(items.begin(), items.end());
+  for (auto _ : state) {
+    for (int key : keys) {
+      benchmark::DoNotOptimize(mp.find(key));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+void BM_FlatMapBuild(benchmark::State& state) {
+  auto items = RandomItems(state.range(0));
+  for (auto _ : state) {
+    FlatMap<int, int> mp;
+    mp.Build(items.begin(), items.end());
+    benchmark::DoNotOptimize(mp.Size());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_FlatMapRandomInsert(benchmark::State& state) {
+  auto items = RandomItems(state.range(0));
+  for (auto _ : state) {
+    FlatMap<int, int> mp;
+    for (const auto& item : items) {
+      mp.Insert(item);
+    }
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+
+BENCHMARK(BM_FlatMapFind)->Range(1<<6, 1<<20)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CustomMapFind)->Range(1<<6, 1<<20)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_StdMapFind)->Range(1<<6, 1<<20)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FlatMapBuild)->Range(1<<10, 1<<20)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_FlatMapRandomInsert)->Range(1<<10, 1<<17)->Complexity()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,141 @@
+#include <map>
+#include <string>
+#include <vector>
+
+#include <fmt/core.h>
+#include <gtest/gtest.h>
+
+#include "../../../vector/vector.cpp"
+#include "../flat_map.hpp"
+
+class FlatMapTest: public testing::Test {
+  protected:
+    void SetUp() override {
+      mp.Insert({
+        {1, 5},
+        {3, 10},
+        {5, 90},
+        {10, -10},
+        {90, 0},
+        {-10, 5},
+        {0, 4}
+      });
+      assert(mp.Size() == sz);
+    }
+
+  FlatMap<int, int> mp;
+  const size_t sz = 7;
+};
+
+
+TEST(EmptyFlatMapTest, DefaultConstructor) {
+  FlatMap<int, int> map;
+  ASSERT_TRUE(map.IsEmpty()) << "Default FlatMap isn't empty!";
+}
+
+TEST(EmptyFlatMapTest, StringAsKey) {
+  FlatMap<std::string, int> map;
+  map["b"] = 2;
+  map["a"] = 1;
+  map["c"] = 3;
+  auto values = map.Values();
+  ASSERT_EQ(values.size(), 3);
+  ASSERT_EQ(values[0].first, "a");
+  ASSERT_EQ(values[2].second, 3);
+}
+
+TEST(EmptyFlatMapTest, BuildSortsAndDeduplicates) {
+  std::vector<std::pair<int, int>> items = {{5, 1}, {2, 1}, {9, 1}, {2, 7}, {-1, 1}};
+  FlatMap<int, int> map;
+  map[100] = 1;
+  map.Build(items.begin(), items.end());
+  ASSERT_EQ(map.Size(), 4);
+  ASSERT_FALSE(map.Find(100));
+  ASSERT_EQ(map[2], 7) << "Later duplicate must win!";
+  auto values = map.Values();
+  for (size_t i = 1; i < values.size(); ++i) {
+    ASSERT_LT(values[i - 1].first, values[i].first);
+  }
+}
+
+TEST(EmptyFlatMapTest, StdSwap) {
+  FlatMap<int, int> a;
+  FlatMap<int, int> b;
+  a[1] = 1;
+  std::swap(a, b);
+  ASSERT_TRUE(a.IsEmpty());
+  ASSERT_TRUE(b.Find(1));
+}
+
+struct ThrowingCopy {
+  ThrowingCopy() = default;
+  ThrowingCopy(const ThrowingCopy&) {
+    throw std::runtime_error("copy");
+  }
+  ThrowingCopy& operator=(const ThrowingCopy&) = default;
+};
+
+TEST(EmptyFlatMapTest, ThrowingValueKeepsKeysInSync) {
+  FlatMap<int, ThrowingCopy> map;
+  ASSERT_THROW(map.Insert({1, ThrowingCopy{}}), std::runtime_error);
+  ASSERT_TRUE(map.IsEmpty());
+  ASSERT_FALSE(map.Find(1));
+  ASSERT_THROW(map[2], std::runtime_error);
+  ASSERT_EQ(map.Size(), 0);
+}
+
+TEST_F(FlatMapTest, GetValueUsingOperator) {
+  ASSERT_EQ(mp[5], 90);
+  ASSERT_EQ(mp[-10], 5);
+}
+
+TEST_F(FlatMapTest, CreateIfNotExist) {
+  ASSERT_EQ(mp[42], 0);
+  ASSERT_EQ(mp.Size(), sz + 1);
+}
+
+TEST_F(FlatMapTest, OverwritingWithInsert) {
+  mp.Insert({3, 33});
+  ASSERT_EQ(mp[3], 33);
+  ASSERT_EQ(mp.Size(), sz);
+}
+
+TEST_F(FlatMapTest, GetDecreaseSortedValues) {
+  std::map<int, int> expected = {{1, 5}, {3, 10}, {5, 90}, {10, -10}, {90, 0}, {-10, 5}, {0, 4}};
+  auto values = mp.Values(false);
+  auto it = expected.rbegin();
+  for (const auto& val : values) {
+    ASSERT_EQ(val.first, it->first);
+    ASSERT_EQ(val.second, it->second);
+    ++it;
+  }
+}
+
+TEST_F(FlatMapTest, FindAndErase) {
+  for (int key : {1, 3, 5, 10, 90, -10, 0}) {
+    ASSERT_TRUE(mp.Find(key)) << fmt::format("Key {} not found", key);
+  }
+  ASSERT_FALSE(mp.Find(2));
+  ASSERT_FALSE(mp.Find(100));
+  ASSERT_FALSE(mp.Find(-100));
+  mp.Erase(5);
+  ASSERT_FALSE(mp.Find(5));
+  ASSERT_EQ(mp.Size(), sz - 1);
+  EXPECT_THROW({
+    mp.Erase(-100);
+  }, MapIsEmptyException);
+}
+
+TEST_F(FlatMapTest, Clear) {
+  mp.Clear();
+  ASSERT_TRUE(mp.IsEmpty());
+}
+
+TEST_F(FlatMapTest, CustomComparator) {
+  FlatMap<int, int, std::greater<int>> map;
+  map.Insert({{1, 1}, {3, 3}, {2, 2}});
+  auto values = map.Values();
+  ASSERT_EQ(values[0].first, 3);
+  ASSERT_EQ(values[2].first, 1);
+  ASSERT_TRUE(map.Find(2));
+}
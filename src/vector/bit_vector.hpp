@@ -0,0 +1,252 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+// Packed bitmap: 64 flags per word. It is a type of its own, so Vector<bool> stays an
+// ordinary Vector for generic code. Bits past Size() in the last word are kept zero, so
+// Count and the word-wise And/Or/Xor never need to mask the tail.
+class BitVector {
+public:
+    static constexpr size_t WORD_BITS = 64;
+
+    BitVector() : words_(nullptr), size_(0), word_capacity_(0) {
+    }
+
+    BitVector(size_t count, bool value) : BitVector() {
+        Resize(count, value);
+    }
+
+    BitVector(const BitVector& other) : BitVector() {
+        if (other.size_ != 0) {
+            Reserve(other.size_);
+            std::memcpy(words_, other.words_, WordCount(other.size_) * sizeof(uint64_t));
+            size_ = other.size_;
+        }
+    }
+
+    BitVector& operator=(const BitVector& other) {
+        if (this != &other) {
+            BitVector temp(other);
+            *this = std::move(temp);
+        }
+        return *this;
+    }
+
+    BitVector(BitVector&& other) noexcept : BitVector() {
+        *this = std::move(other);
+    }
+
+    BitVector& operator=(BitVector&& other) noexcept {
+        std::swap(words_, other.words_);
+        std::swap(size_, other.size_);
+        std::swap(word_capacity_, other.word_capacity_);
+        return *this;
+    }
+
+    bool operator[](size_t pos) const {
+        if (pos >= size_) {
+            throw std::out_of_range("BitVector access out of range");
+        }
+        return (words_[pos / WORD_BITS] >> (pos % WORD_BITS)) & 1;
+    }
+
+    void Set(size_t pos, bool value = true) {
+        if (pos >= size_) {
+            throw std::out_of_range("BitVector access out of range");
+        }
+        uint64_t mask = uint64_t(1) << (pos % WORD_BITS);
+        words_[pos / WORD_BITS] = value ? (words_[pos / WORD_BITS] | mask) : (words_[pos / WORD_BITS] & ~mask);
+    }
+
+    void Reset(size_t pos) {
+        Set(pos, false);
+    }
+
+    const uint64_t* Data() const noexcept {
+        return words_;
+    }
+
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept {
+        return word_capacity_ * WORD_BITS;
+    }
+
+    void Reserve(size_t new_cap) {
+        size_t words = WordCount(new_cap);
+        if (words <= word_capacity_) {
+            return;
+        }
+        uint64_t* new_words = static_cast<uint64_t*>(realloc(words_, words * sizeof(uint64_t)));
+        if (!new_words) {
+            throw std::bad_alloc();
+        }
+        words_ = new_words;
+        word_capacity_ = words;
+    }
+
+    void Clear() noexcept {
+        if (size_ != 0) {
+            std::memset(words_, 0, WordCount(size_) * sizeof(uint64_t));
+            size_ = 0;
+        }
+    }
+
+    void PushBack(bool value) {
+        if (size_ % WORD_BITS == 0) {
+            if (size_ == Capacity()) {
+                Reserve(std::max<size_t>(2 * Capacity(), WORD_BITS));
+            }
+            words_[size_ / WORD_BITS] = 0;
+        }
+        words_[size_ / WORD_BITS] |= uint64_t(value) << (size_ % WORD_BITS);
+        ++size_;
+    }
+
+    void PopBack() {
+        if (size_ > 0) {
+            --size_;
+            words_[size_ / WORD_BITS] &= ~(uint64_t(1) << (size_ % WORD_BITS));
+        }
+    }
+
+    void Resize(size_t count, bool value = false) {
+        if (count == size_) {
+            return;
+        }
+        if (count < size_) {
+            size_t words = WordCount(count);
+            std::memset(words_ + words, 0, (WordCount(size_) - words) * sizeof(uint64_t));
+            size_ = count;
+            ClearTail();
+            return;
+        }
+        Reserve(count);
+        if (size_ % WORD_BITS != 0 && value) {
+            words_[size_ / WORD_BITS] |= ~uint64_t(0) << (size_ % WORD_BITS);
+        }
+        size_t first_new = WordCount(size_);
+        std::memset(words_ + first_new, value ? 0xFF : 0, (WordCount(count) - first_new) * sizeof(uint64_t));
+        size_ = count;
+        ClearTail();
+    }
+
+    BitVector& And(const BitVector& other) {
+        CheckSameSize(other);
+        for (size_t i = 0; i < WordCount(size_); ++i) {
+            words_[i] &= other.words_[i];
+        }
+        return *this;
+    }
+
+    BitVector& Or(const BitVector& other) {
+        CheckSameSize(other);
+        for (size_t i = 0; i < WordCount(size_); ++i) {
+            words_[i] |= other.words_[i];
+        }
+        return *this;
+    }
+
+    BitVector& Xor(const BitVector& other) {
+        CheckSameSize(other);
+        for (size_t i = 0; i < WordCount(size_); ++i) {
+            words_[i] ^= other.words_[i];
+        }
+        return *this;
+    }
+
+    size_t Count() const noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+        static const bool has_popcnt = [] {
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("popcnt");
+        }();
+        if (has_popcnt) {
+            return CountPopcnt(words_, WordCount(size_));
+        }
+#endif
+        return CountGeneric(words_, WordCount(size_));
+    }
+
+    // Position of the first set bit, or Size() if there is none.
+    size_t FindFirst() const noexcept {
+        return FindFrom(0);
+    }
+
+    // Position of the first set bit after pos, or Size() if there is none.
+    size_t FindNext(size_t pos) const noexcept {
+        return FindFrom(pos + 1);
+    }
+
+    ~BitVector() noexcept {
+        free(words_);
+    }
+
+private:
+    static size_t WordCount(size_t bits) noexcept {
+        return (bits + WORD_BITS - 1) / WORD_BITS;
+    }
+
+    static size_t CountGeneric(const uint64_t* words, size_t count) noexcept {
+        size_t total = 0;
+        for (size_t i = 0; i < count; ++i) {
+            total += __builtin_popcountll(words[i]);
+        }
+        return total;
+    }
+
+#if defined(__x86_64__) || defined(__i386__)
+    [[gnu::target("popcnt")]] static size_t CountPopcnt(const uint64_t* words, size_t count) noexcept {
+        size_t total = 0;
+        for (size_t i = 0; i < count; ++i) {
+            total += __builtin_popcountll(words[i]);
+        }
+        return total;
+    }
+#endif
+
+    void ClearTail() noexcept {
+        if (size_ % WORD_BITS != 0) {
+            words_[size_ / WORD_BITS] &= ~(~uint64_t(0) << (size_ % WORD_BITS));
+        }
+    }
+
+    void CheckSameSize(const BitVector& other) const {
+        if (other.size_ != size_) {
+            throw std::invalid_argument("BitVector sizes differ");
+        }
+    }
+
+    size_t FindFrom(size_t pos) const noexcept {
+        if (pos >= size_) {
+            return size_;
+        }
+        size_t word = pos / WORD_BITS;
+        uint64_t bits = words_[word] & (~uint64_t(0) << (pos % WORD_BITS));
+        size_t words = WordCount(size_);
+        while (bits == 0) {
+            if (++word == words) {
+                return size_;
+            }
+            bits = words_[word];
+        }
+        return word * WORD_BITS + __builtin_ctzll(bits);
+    }
+
+    uint64_t* words_;
+    size_t size_;
+    size_t word_capacity_;
+};
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#include "simd.hpp"
+#include "vector.hpp"
+
+// Append-only vector of uint64_t compressed in blocks of BLOCK_SIZE values. Each block keeps
+// its first value as a base and bit-packs the deltas between neighbours at the width of the
+// largest one, so sorted IDs and timestamps shrink to a few bits per value. The last,
+// incomplete block stays uncompressed. Random access decodes a block prefix; ForEach and
+// Decode unpack whole blocks, four values per AVX2 gather when the CPU has it.
+class CompressedVector {
+public:
+    static constexpr size_t BLOCK_SIZE = 128;
+
+    CompressedVector() : size_(0) {
+    }
+
+    uint64_t operator[](size_t pos) const {
+        if (pos >= size_) {
+            throw std::out_of_range("CompressedVector access out of range");
+        }
+        size_t block = pos / BLOCK_SIZE;
+        size_t index = pos % BLOCK_SIZE;
+        if (block == blocks_.Size()) {
+            return tail_[index];
+        }
+        const Block& header = blocks_.Data()[block];
+        const uint64_t* words = words_.Data() + header.offset;
+        uint64_t value = header.base;
+        for (size_t i = 1; i <= index; ++i) {
+            value += Unpack(words, i, header.width);
+        }
+        return value;
+    }
+
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t BlockCount() const noexcept {
+        return blocks_.Size();
+    }
+
+    // Bytes held by the encoded blocks, their headers and the uncompressed tail.
+    size_t CompressedBytes() const noexcept {
+        return words_.Size() * sizeof(uint64_t) + blocks_.Size() * sizeof(Block) + sizeof(tail_);
+    }
+
+    void PushBack(uint64_t value) {
+        tail_[size_ % BLOCK_SIZE] = value;
+        ++size_;
+        if (size_ % BLOCK_SIZE == 0) {
+            EncodeTail();
+        }
+    }
+
+    void Clear() noexcept {
+        words_.Clear();
+        blocks_.Clear();
+        size_ = 0;
+    }
+
+    // Writes the BLOCK_SIZE values of an encoded block to out.
+    void DecodeBlock(size_t block, uint64_t* out, SimdLevel level = DetectSimdLevel()) const {
+        if (block >= blocks_.Size()) {
+            throw std::out_of_range("CompressedVector block out of range");
+        }
+        const Block& header = blocks_.Data()[block];
+        UnpackBlock(words_.Data() + header.offset, header.width, out, level);
+        uint64_t value = header.base;
+        for (size_t i = 0; i < BLOCK_SIZE; ++i) {
+            value += out[i];
+            out[i] = value;
+        }
+    }
+
+    template <typename F>
+    void ForEach(F fn, SimdLevel level = DetectSimdLevel()) const {
+        uint64_t values[BLOCK_SIZE];
+        for (size_t block = 0; block < blocks_.Size(); ++block) {
+            DecodeBlock(block, values, level);
+            for (size_t i = 0; i < BLOCK_SIZE; ++i) {
+                fn(values[i]);
+            }
+        }
+        for (size_t i = 0; i < size_ % BLOCK_SIZE; ++i) {
+            fn(tail_[i]);
+        }
+    }
+
+    // Appends every value to out.
+    template <typename... Options>
+    void Decode(Vector<uint64_t, Options...>& out, SimdLevel level = DetectSimdLevel()) const {
+        size_t start = out.Size();
+        out.ResizeUninitialized(start + size_);
+        uint64_t* dst = out.Data() + start;
+        for (size_t block = 0; block < blocks_.Size(); ++block) {
+            DecodeBlock(block, dst + block * BLOCK_SIZE, level);
+        }
+        for (size_t i = 0; i < size_ % BLOCK_SIZE; ++i) {
+            dst[blocks_.Size() * BLOCK_SIZE + i] = tail_[i];
+        }
+    }
+
+private:
+    struct Block {
+        uint64_t base;
+        size_t offset;
+        uint32_t width;
+    };
+
+    static uint64_t Mask(uint32_t width) noexcept {
+        return width == 64 ? ~uint64_t(0) : (uint64_t(1) << width) - 1;
+    }
+
+    static uint64_t Unpack(const uint64_t* words, size_t index, uint32_t width) noexcept {
+        size_t bit = index * width;
+        size_t word = bit / 64;
+        size_t shift = bit % 64;
+        uint64_t value = words[word] >> shift;
+        if (shift != 0) {
+            value |= words[word + 1] << (64 - shift);
+        }
+        return value & Mask(width);
+    }
+
+    // Writes the raw deltas of a block, the first one being zero.
+    static void UnpackBlock(const uint64_t* words, uint32_t width, uint64_t* out,
+                            [[maybe_unused]] SimdLevel level) {
+#ifdef VECTOR_SIMD_X86
+        if (level >= SimdLevel::AVX2) {
+            UnpackBlockAvx2(words, width, out);
+            return;
+        }
+#endif
+        for (size_t i = 0; i < BLOCK_SIZE; ++i) {
+            out[i] = Unpack(words, i, width);
+        }
+    }
+
+#ifdef VECTOR_SIMD_X86
+    // Gathers the two words each of four values straddles and shifts them into place.
+    // A left shift by 64 yields zero, so values that fit in one word need no special case.
+    [[gnu::target("avx2")]] static void UnpackBlockAvx2(const uint64_t* words, uint32_t width, uint64_t* out) {
+        const __m256i mask = _mm256_set1_epi64x(static_cast<long long>(Mask(width)));
+        const __m256i step = _mm256_set1_epi64x(static_cast<long long>(4 * width));
+        const __m256i sixty_four = _mm256_set1_epi64x(64);
+        const __m256i low_bits = _mm256_set1_epi64x(63);
+        const long long* base = reinterpret_cast<const long long*>(words);
+        __m256i bits = _mm256_setr_epi64x(0, width, 2 * width, 3 * width);
+        for (size_t i = 0; i < BLOCK_SIZE; i += 4) {
+            __m256i index = _mm256_srli_epi64(bits, 6);
+            __m256i shift = _mm256_and_si256(bits, low_bits);
+            __m256i low = _mm256_i64gather_epi64(base, index, 8);
+            __m256i high = _mm256_i64gather_epi64(base + 1, index, 8);
+            __m256i value = _mm256_or_si256(_mm256_srlv_epi64(low, shift),
+                                            _mm256_sllv_epi64(high, _mm256_sub_epi64(sixty_four, shift)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_and_si256(value, mask));
+            bits = _mm256_add_epi64(bits, step);
+        }
+    }
+#endif
+
+    void EncodeTail() {
+        uint64_t deltas[BLOCK_SIZE];
+        deltas[0] = 0;
+        uint64_t widest = 0;
+        for (size_t i = 1; i < BLOCK_SIZE; ++i) {
+            deltas[i] = tail_[i] - tail_[i - 1];
+            widest |= deltas[i];
+        }
+        uint32_t width = widest == 0 ? 0 : 64 - __builtin_clzll(widest);
+        size_t offset = words_.Size();
+        // One spare word past the payload lets Unpack and the gathers always read word + 1.
+        words_.ResizeZeroed(offset + (BLOCK_SIZE * width + 63) / 64 + 1);
+        uint64_t* words = words_.Data() + offset;
+        for (size_t i = 1; width != 0 && i < BLOCK_SIZE; ++i) {
+            size_t bit = i * width;
+            words[bit / 64] |= deltas[i] << (bit % 64);
+            if (bit % 64 != 0 && bit % 64 + width > 64) {
+                words[bit / 64 + 1] |= deltas[i] >> (64 - bit % 64);
+            }
+        }
+        blocks_.PushBack({tail_[0], offset, width});
+    }
+
+    Vector<uint64_t> words_;
+    Vector<Block> blocks_;
+    uint64_t tail_[BLOCK_SIZE];
+    size_t size_;
+};
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Append-only vector for many producer threads. Storage is a fixed table of segments,
+// segment k holding FIRST_SEGMENT << k elements, so elements never move and references
+// stay valid. Producers claim a slot with a fetch_add, construct in place and mark
+// the slot ready; whoever finds the next slots settled moves the published size past them,
+// so no producer waits for another. Readers may index anything below Size() without locking.
+// A slot whose constructor or segment allocation threw is published as a hole: it counts
+// towards Size(), indexing it throws std::out_of_range and HasValue reports false.
+template <typename T, typename Alloc = std::allocator<T>>
+class ConcurrentVector {
+public:
+    static constexpr size_t FIRST_SEGMENT_BITS = 6;
+    static constexpr size_t FIRST_SEGMENT = size_t(1) << FIRST_SEGMENT_BITS;
+    static constexpr size_t MAX_SEGMENTS = 64 - FIRST_SEGMENT_BITS;
+
+    ConcurrentVector() : reserved_(0), published_(0), segments_(), states_() {
+    }
+
+    ConcurrentVector(const ConcurrentVector& other) = delete;
+
+    ConcurrentVector& operator=(const ConcurrentVector& other) = delete;
+
+    T& operator[](size_t pos) {
+        CheckValue(pos);
+        return *Slot(pos);
+    }
+
+    const T& operator[](size_t pos) const {
+        CheckValue(pos);
+        return *Slot(pos);
+    }
+
+    // False for positions past Size() and for holes left by failed constructions.
+    bool HasValue(size_t pos) const noexcept {
+        return pos < Size() && State(pos) == READY;
+    }
+
+    bool IsEmpty() const noexcept {
+        return Size() == 0;
+    }
+
+    // Number of published elements; every index below it is readable.
+    size_t Size() const noexcept {
+        return published_.load(std::memory_order_acquire);
+    }
+
+    size_t PushBack(const T& value) {
+        return EmplaceBack(value);
+    }
+
+    size_t PushBack(T&& value) {
+        return EmplaceBack(std::move(value));
+    }
+
+    // Returns the index of the new element. If construction throws, the slot becomes a hole
+    // and the exception propagates.
+    template <class... Args>
+    size_t EmplaceBack(Args&&... args) {
+        size_t pos = reserved_.fetch_add(1, std::memory_order_relaxed);
+        auto [segment, offset] = Locate(pos);
+        std::atomic<uint8_t>* states = States(segment);
+        try {
+            T* data = Segment(segments_[segment], SegmentSize(segment), allocator_);
+            std::allocator_traits<Alloc>::construct(allocator_, data + offset, std::forward<Args>(args)...);
+        } catch (...) {
+            states[offset].store(HOLE);
+            Publish();
+            throw;
+        }
+        states[offset].store(READY);
+        Publish();
+        return pos;
+    }
+
+    ~ConcurrentVector() {
+        size_t size = Size();
+        for (size_t pos = 0; pos < size; ++pos) {
+            if (State(pos) == READY) {
+                std::allocator_traits<Alloc>::destroy(allocator_, Slot(pos));
+            }
+        }
+        for (size_t segment = 0; segment < MAX_SEGMENTS; ++segment) {
+            if (T* data = segments_[segment].load(std::memory_order_relaxed)) {
+                allocator_.deallocate(data, SegmentSize(segment));
+            }
+            if (std::atomic<uint8_t>* states = states_[segment].load(std::memory_order_relaxed)) {
+                state_allocator_.deallocate(states, SegmentSize(segment));
+            }
+        }
+    }
+
+private:
+    static size_t SegmentSize(size_t segment) noexcept {
+        return FIRST_SEGMENT << segment;
+    }
+
+    static std::pair<size_t, size_t> Locate(size_t pos) noexcept {
+        size_t biased = pos + FIRST_SEGMENT;
+        size_t segment = 63 - __builtin_clzll(biased) - FIRST_SEGMENT_BITS;
+        return {segment, biased - SegmentSize(segment)};
+    }
+
+    T* Slot(size_t pos) const noexcept {
+        auto [segment, offset] = Locate(pos);
+        return segments_[segment].load(std::memory_order_relaxed) + offset;
+    }
+
+    static constexpr uint8_t PENDING = 0;
+    static constexpr uint8_t READY = 1;
+    static constexpr uint8_t HOLE = 2;
+
+    uint8_t State(size_t pos) const noexcept {
+        auto [segment, offset] = Locate(pos);
+        std::atomic<uint8_t>* states = states_[segment].load(std::memory_order_acquire);
+        return states ? states[offset].load() : PENDING;
+    }
+
+    void CheckValue(size_t pos) const {
+        if (pos >= Size() || State(pos) != READY) {
+            throw std::out_of_range("ConcurrentVector access out of range");
+        }
+    }
+
+    // A claimed slot must be settled or Publish stalls at it for good, so failing to allocate
+    // the state flags (one byte per element) after the claim terminates instead of throwing.
+    std::atomic<uint8_t>* States(size_t segment) noexcept {
+        return Segment(states_[segment], SegmentSize(segment), state_allocator_);
+    }
+
+    // Moves the published size over every settled slot. A producer whose slot is still
+    // pending publishes it itself once settled, so each slot is published exactly once.
+    void Publish() noexcept {
+        size_t published = published_.load();
+        while (published < reserved_.load() && State(published) != PENDING) {
+            published_.compare_exchange_weak(published, published + 1);
+        }
+    }
+
+    // Producers racing for the same new segment each allocate one; the loser frees its copy.
+    template <typename U, typename SegmentAlloc>
+    static U* Segment(std::atomic<U*>& slot, size_t size, SegmentAlloc& allocator) {
+        U* data = slot.load(std::memory_order_acquire);
+        if (data) {
+            return data;
+        }
+        U* fresh = allocator.allocate(size);
+        if constexpr (std::is_same_v<U, std::atomic<uint8_t>>) {
+            for (size_t i = 0; i < size; ++i) {
+                new (fresh + i) std::atomic<uint8_t>(PENDING);
+            }
+        }
+        if (slot.compare_exchange_strong(data, fresh, std::memory_order_acq_rel)) {
+            return fresh;
+        }
+        allocator.deallocate(fresh, size);
+        return data;
+    }
+
+    using StateAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<std::atomic<uint8_t>>;
+
+    Alloc allocator_;
+    StateAlloc state_allocator_;
+    std::atomic<size_t> reserved_;
+    std::atomic<size_t> published_;
+    std::atomic<T*> segments_[MAX_SEGMENTS];
+    std::atomic<std::atomic<uint8_t>*> states_[MAX_SEGMENTS];
+};
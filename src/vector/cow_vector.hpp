@@ -0,0 +1,200 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "vector.hpp"
+
+// Copy-on-write Vector: copies share one reference-counted buffer, and the first mutation
+// through a shared copy gives it a private one. The count is atomic, so snapshots may be
+// handed to other threads; a single CowVector object is still not safe to mutate concurrently.
+// An empty or moved-from CowVector holds no buffer and allocates one on its first mutation.
+template <typename T, typename Alloc = std::allocator<T>, typename GrowthPolicy = DoublingGrowth>
+class CowVector {
+public:
+    CowVector() noexcept : shared_(nullptr) {
+    }
+
+    CowVector(size_t count, const T& value) : shared_(new Shared(count, value)) {
+    }
+
+    CowVector(std::initializer_list<T> init) : shared_(new Shared(init)) {
+    }
+
+    CowVector(const CowVector& other) noexcept : shared_(other.shared_) {
+        if (shared_) {
+            shared_->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    CowVector& operator=(const CowVector& other) noexcept {
+        if (shared_ != other.shared_) {
+            if (other.shared_) {
+                other.shared_->refs.fetch_add(1, std::memory_order_relaxed);
+            }
+            Release();
+            shared_ = other.shared_;
+        }
+        return *this;
+    }
+
+    CowVector(CowVector&& other) noexcept : shared_(std::exchange(other.shared_, nullptr)) {
+    }
+
+    CowVector& operator=(CowVector&& other) noexcept {
+        if (this != &other) {
+            Release();
+            shared_ = std::exchange(other.shared_, nullptr);
+        }
+        return *this;
+    }
+
+    const T& operator[](size_t pos) const {
+        if (!shared_) {
+            throw std::out_of_range("CowVector access out of range");
+        }
+        return shared_->vec.At(pos);
+    }
+
+    // Writable access; detaches from other copies first.
+    T& Mutable(size_t pos) {
+        Detach();
+        return shared_->vec.At(pos);
+    }
+
+    const T& Front() const {
+        if (IsEmpty()) {
+            throw std::out_of_range("CowVector Front of an empty vector");
+        }
+        return shared_->vec.Front();
+    }
+
+    const T& Back() const {
+        if (IsEmpty()) {
+            throw std::out_of_range("CowVector Back of an empty vector");
+        }
+        return shared_->vec.Back();
+    }
+
+    const T* Data() const noexcept {
+        return shared_ ? shared_->vec.Data() : nullptr;
+    }
+
+    T* MutableData() {
+        Detach();
+        return shared_->vec.Data();
+    }
+
+    bool IsEmpty() const noexcept {
+        return Size() == 0;
+    }
+
+    size_t Size() const noexcept {
+        return shared_ ? shared_->vec.Size() : 0;
+    }
+
+    size_t Capacity() const noexcept {
+        return shared_ ? shared_->vec.Capacity() : 0;
+    }
+
+    // Zero while no buffer is allocated.
+    size_t UseCount() const noexcept {
+        return shared_ ? shared_->refs.load(std::memory_order_relaxed) : 0;
+    }
+
+    bool IsShared() const noexcept {
+        return UseCount() > 1;
+    }
+
+    void Reserve(size_t new_cap) {
+        Detach();
+        shared_->vec.Reserve(new_cap);
+    }
+
+    void Clear() noexcept {
+        if (IsShared()) {
+            Release();
+            shared_ = nullptr;
+        } else if (shared_) {
+            shared_->vec.Clear();
+        }
+    }
+
+    void Insert(size_t pos, T value) {
+        Detach();
+        shared_->vec.Insert(pos, std::move(value));
+    }
+
+    void Erase(size_t begin_pos, size_t end_pos) {
+        Detach();
+        shared_->vec.Erase(begin_pos, end_pos);
+    }
+
+    void PushBack(T value) {
+        Detach();
+        shared_->vec.PushBack(std::move(value));
+    }
+
+    template <class... Args>
+    void EmplaceBack(Args&&... args) {
+        Detach();
+        shared_->vec.EmplaceBack(std::forward<Args>(args)...);
+    }
+
+    void PopBack() {
+        Detach();
+        shared_->vec.PopBack();
+    }
+
+    void Resize(size_t count, const T& value) {
+        Detach();
+        shared_->vec.Resize(count, value);
+    }
+
+    ~CowVector() {
+        Release();
+    }
+
+private:
+    struct Shared {
+        Shared() : refs(1) {
+        }
+
+        Shared(size_t count, const T& value) : refs(1), vec(count, value) {
+        }
+
+        Shared(std::initializer_list<T> init) : refs(1), vec(init) {
+        }
+
+        explicit Shared(const Vector<T, Alloc, GrowthPolicy>& other) : refs(1), vec(other) {
+        }
+
+        std::atomic<size_t> refs;
+        Vector<T, Alloc, GrowthPolicy> vec;
+    };
+
+    void Detach() {
+        if (!shared_) {
+            shared_ = new Shared();
+            return;
+        }
+        if (shared_->refs.load(std::memory_order_acquire) == 1) {
+            return;
+        }
+        Shared* copy = new Shared(shared_->vec);
+        Release();
+        shared_ = copy;
+    }
+
+    void Release() noexcept {
+        if (shared_ && shared_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete shared_;
+        }
+    }
+
+    Shared* shared_;
+};
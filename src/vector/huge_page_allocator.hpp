@@ -0,0 +1,137 @@
+#pragma once
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+// Linux allocator for large buffers: blocks from MMAP_THRESHOLD bytes up are mapped
+// with mmap on a 2 MiB boundary and backed by transparent huge pages, and reallocate grows
+// them with mremap, which moves page table entries instead of copying the data.
+template <typename T>
+class HugePageAllocator {
+public:
+    using value_type = T;
+
+    static constexpr size_t HUGE_PAGE_SIZE = size_t(1) << 21;
+    static constexpr size_t MMAP_THRESHOLD = HUGE_PAGE_SIZE;
+
+    HugePageAllocator() = default;
+
+    template <typename U>
+    HugePageAllocator(const HugePageAllocator<U>&) noexcept {
+    }
+
+    T* allocate(size_t n) {
+        if (!IsMapped(n)) {
+            void* ptr = std::malloc(n * sizeof(T));
+            if (!ptr) {
+                throw std::bad_alloc();
+            }
+            return static_cast<T*>(ptr);
+        }
+        return static_cast<T*>(MapAligned(MappedBytes(n)));
+    }
+
+    // Fresh anonymous mappings are zero-filled by the kernel and calloc gets zeroed pages
+    // from it for large requests, so neither path writes the zeros itself.
+    T* allocate_zeroed(size_t n) {
+        if (!IsMapped(n)) {
+            void* ptr = std::calloc(n, sizeof(T));
+            if (!ptr) {
+                throw std::bad_alloc();
+            }
+            return static_cast<T*>(ptr);
+        }
+        return allocate(n);
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept {
+        if (IsMapped(n)) {
+            munmap(ptr, MappedBytes(n));
+        } else {
+            std::free(ptr);
+        }
+    }
+
+    // Only valid for trivially relocatable T: the contents are moved bytewise. Only the first
+    // live_n elements are preserved, so leaving the mapped range copies no spare capacity.
+    T* reallocate(T* ptr, size_t old_n, size_t new_n, size_t live_n) {
+        if (IsMapped(old_n) && IsMapped(new_n)) {
+            size_t old_bytes = MappedBytes(old_n);
+            size_t new_bytes = MappedBytes(new_n);
+            if (old_bytes == new_bytes) {
+                return ptr;
+            }
+            if (new_bytes < old_bytes || mremap(ptr, old_bytes, new_bytes, 0) != MAP_FAILED) {
+                if (new_bytes < old_bytes) {
+                    munmap(reinterpret_cast<char*>(ptr) + new_bytes, old_bytes - new_bytes);
+                }
+                madvise(ptr, new_bytes, MADV_HUGEPAGE);
+                return ptr;
+            }
+            // Growing in place failed: move the page tables onto a fresh aligned range,
+            // which MREMAP_FIXED replaces atomically.
+            void* target = MapAligned(new_bytes);
+            void* new_ptr = mremap(ptr, old_bytes, new_bytes, MREMAP_MAYMOVE | MREMAP_FIXED, target);
+            if (new_ptr == MAP_FAILED) {
+                munmap(target, new_bytes);
+                throw std::bad_alloc();
+            }
+            return static_cast<T*>(new_ptr);
+        }
+        if (!IsMapped(old_n) && !IsMapped(new_n)) {
+            void* new_ptr = std::realloc(ptr, new_n * sizeof(T));
+            if (!new_ptr) {
+                throw std::bad_alloc();
+            }
+            return static_cast<T*>(new_ptr);
+        }
+        T* new_ptr = allocate(new_n);
+        live_n = std::min({live_n, old_n, new_n});
+        std::memcpy(static_cast<void*>(new_ptr), static_cast<const void*>(ptr), live_n * sizeof(T));
+        deallocate(ptr, old_n);
+        return new_ptr;
+    }
+
+    template <typename U>
+    bool operator==(const HugePageAllocator<U>&) const noexcept {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const HugePageAllocator<U>&) const noexcept {
+        return false;
+    }
+
+private:
+    static bool IsMapped(size_t n) noexcept {
+        return n * sizeof(T) >= MMAP_THRESHOLD;
+    }
+
+    // Maps bytes + HUGE_PAGE_SIZE and trims both ends, so the whole block starts on a huge
+    // page boundary and THP can back all of it rather than only the aligned interior.
+    static void* MapAligned(size_t bytes) {
+        size_t span = bytes + HUGE_PAGE_SIZE;
+        void* raw = mmap(nullptr, span, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        char* start = static_cast<char*>(raw);
+        char* aligned = reinterpret_cast<char*>((reinterpret_cast<uintptr_t>(start) + HUGE_PAGE_SIZE - 1) &
+                                                ~(HUGE_PAGE_SIZE - 1));
+        if (aligned != start) {
+            munmap(start, aligned - start);
+        }
+        munmap(aligned + bytes, start + span - (aligned + bytes));
+        madvise(aligned, bytes, MADV_HUGEPAGE);
+        return aligned;
+    }
+
+    static size_t MappedBytes(size_t n) noexcept {
+        return (n * sizeof(T) + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+    }
+};
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "vector.hpp"
+
+// Vector whose growth never copies the whole buffer in one call. Growing allocates the new
+// buffer and keeps the old one; every later push moves a few elements across, at least Step
+// and enough to finish before the new buffer fills. With geometric growth that is Step, so
+// the worst single push costs O(Step) element moves instead of O(Size()); with
+// FixedStepGrowth<K> it is Size() / K. While a migration is pending, positions
+// [migrated, old size) still live in the old buffer and indexed access picks the right one.
+// Data() needs a contiguous buffer and finishes the migration.
+template <typename T, typename Alloc = std::allocator<T>, typename GrowthPolicy = DoublingGrowth, size_t Step = 4>
+class IncrementalVector {
+public:
+    static_assert(Step > 0, "Migration step must be positive");
+
+    static constexpr size_t CAPACITY = 10;
+
+    IncrementalVector()
+        : data_(nullptr),
+          size_(0),
+          capacity_(0),
+          old_(nullptr),
+          old_size_(0),
+          old_capacity_(0),
+          migrated_(0),
+          step_(Step) {
+    }
+
+    IncrementalVector(const IncrementalVector& other) = delete;
+
+    IncrementalVector& operator=(const IncrementalVector& other) = delete;
+
+    T& operator[](size_t pos) {
+        if (pos >= size_) {
+            throw std::out_of_range("IncrementalVector access out of range");
+        }
+        return *Slot(pos);
+    }
+
+    const T& operator[](size_t pos) const {
+        if (pos >= size_) {
+            throw std::out_of_range("IncrementalVector access out of range");
+        }
+        return *Slot(pos);
+    }
+
+    T& Back() noexcept {
+        return *Slot(size_ - 1);
+    }
+
+    T* Data() {
+        FinishMigration();
+        return data_;
+    }
+
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    bool IsMigrating() const noexcept {
+        return old_ != nullptr;
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept {
+        return capacity_;
+    }
+
+    void Reserve(size_t new_cap) {
+        if (new_cap > capacity_) {
+            StartMigration(std::max(new_cap, CAPACITY));
+        }
+    }
+
+    void Clear() noexcept {
+        for (size_t pos = 0; pos < size_; ++pos) {
+            std::allocator_traits<Alloc>::destroy(allocator_, Slot(pos));
+        }
+        size_ = 0;
+        ReleaseOld();
+    }
+
+    void PushBack(T value) {
+        EmplaceBack(std::move(value));
+    }
+
+    template <class... Args>
+    void EmplaceBack(Args&&... args) {
+        if (size_ >= capacity_) {
+            StartMigration(std::max(GrowthPolicy::NextCapacity(capacity_, size_ + 1, sizeof(T)), CAPACITY));
+        }
+        std::allocator_traits<Alloc>::construct(allocator_, data_ + size_, std::forward<Args>(args)...);
+        ++size_;
+        Migrate(step_);
+    }
+
+    void PopBack() {
+        if (size_ == 0) {
+            return;
+        }
+        --size_;
+        std::allocator_traits<Alloc>::destroy(allocator_, Slot(size_));
+        if (old_ && size_ < old_size_) {
+            old_size_ = size_;
+            Migrate(0);
+        }
+    }
+
+    void FinishMigration() {
+        if (old_) {
+            Migrate(old_size_ - migrated_);
+        }
+    }
+
+    ~IncrementalVector() {
+        Clear();
+        if (data_) {
+            allocator_.deallocate(data_, capacity_);
+        }
+    }
+
+private:
+    T* Slot(size_t pos) const noexcept {
+        return (pos >= migrated_ && pos < old_size_) ? old_ + pos : data_ + pos;
+    }
+
+    void StartMigration(size_t new_cap) {
+        FinishMigration();
+        T* fresh = allocator_.allocate(new_cap);
+        // The new buffer takes new_cap - size_ pushes to fill; the old one must be empty by then.
+        size_t pushes = new_cap - size_;
+        step_ = std::max(Step, (size_ + pushes - 1) / pushes);
+        old_ = data_;
+        old_size_ = size_;
+        old_capacity_ = capacity_;
+        migrated_ = 0;
+        data_ = fresh;
+        capacity_ = new_cap;
+        Migrate(0);
+    }
+
+    // Moves up to count pending elements into the new buffer and frees the old one when done.
+    void Migrate(size_t count) {
+        if (!old_) {
+            return;
+        }
+        count = std::min(count, old_size_ - migrated_);
+        if constexpr (IsTriviallyRelocatable<T>::value) {
+            std::memcpy(static_cast<void*>(data_ + migrated_), static_cast<const void*>(old_ + migrated_),
+                        count * sizeof(T));
+        } else {
+            for (size_t i = migrated_; i < migrated_ + count; ++i) {
+                std::allocator_traits<Alloc>::construct(allocator_, data_ + i, std::move(old_[i]));
+                std::allocator_traits<Alloc>::destroy(allocator_, old_ + i);
+            }
+        }
+        migrated_ += count;
+        if (migrated_ == old_size_) {
+            ReleaseOld();
+        }
+    }
+
+    void ReleaseOld() noexcept {
+        if (old_) {
+            allocator_.deallocate(old_, old_capacity_);
+        }
+        old_ = nullptr;
+        old_size_ = 0;
+        old_capacity_ = 0;
+        migrated_ = 0;
+    }
+
+    Alloc allocator_;
+    T* data_;
+    size_t size_;
+    size_t capacity_;
+    T* old_;
+    size_t old_size_;
+    size_t old_capacity_;
+    size_t migrated_;
+    size_t step_;
+};
@@ -0,0 +1,282 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include "vector.hpp"
+
+enum class MappedAccess {
+    NORMAL,
+    SEQUENTIAL,
+    RANDOM,
+    WILL_NEED,
+};
+
+// Vector of trivially copyable elements living in a shared file mapping. The file holds
+// a small header with the element count followed by the raw elements, so opening an
+// existing file maps it in place without reading or copying anything. Growth extends
+// the file with ftruncate and moves the mapping with mremap.
+template <typename T, typename GrowthPolicy = DoublingGrowth>
+class MappedVector {
+public:
+    static_assert(std::is_trivially_copyable_v<T>, "MappedVector stores elements as raw bytes");
+    static_assert(alignof(T) <= 64, "MappedVector elements start 64 bytes into the mapping");
+
+    static constexpr size_t CAPACITY = 10;
+
+    explicit MappedVector(const std::string& path, MappedAccess access = MappedAccess::NORMAL)
+        : fd_(-1), header_(nullptr), capacity_(0), access_(access) {
+        fd_ = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd_ < 0) {
+            throw std::system_error(errno, std::generic_category(), "MappedVector open " + path);
+        }
+        struct stat st;
+        if (fstat(fd_, &st) != 0) {
+            int error = errno;
+            close(fd_);
+            throw std::system_error(error, std::generic_category(), "MappedVector stat " + path);
+        }
+        size_t bytes = static_cast<size_t>(st.st_size);
+        try {
+            if (bytes == 0) {
+                Map(0, CAPACITY);
+                header_->magic = MAGIC;
+                header_->elem_size = sizeof(T);
+                header_->size = 0;
+            } else {
+                if (bytes < sizeof(Header)) {
+                    throw std::runtime_error("MappedVector file is truncated: " + path);
+                }
+                Map(bytes, (bytes - sizeof(Header)) / sizeof(T));
+                if (header_->magic != MAGIC || header_->elem_size != sizeof(T) || header_->size > capacity_) {
+                    throw std::runtime_error("MappedVector file format mismatch: " + path);
+                }
+            }
+        } catch (...) {
+            Unmap();
+            throw;
+        }
+    }
+
+    MappedVector(const MappedVector& other) = delete;
+
+    MappedVector& operator=(const MappedVector& other) = delete;
+
+    MappedVector(MappedVector&& other) noexcept
+        : fd_(other.fd_), header_(other.header_), capacity_(other.capacity_), access_(other.access_) {
+        other.fd_ = -1;
+        other.header_ = nullptr;
+        other.capacity_ = 0;
+    }
+
+    MappedVector& operator=(MappedVector&& other) noexcept {
+        if (this != &other) {
+            Unmap();
+            std::swap(fd_, other.fd_);
+            std::swap(header_, other.header_);
+            std::swap(capacity_, other.capacity_);
+            std::swap(access_, other.access_);
+        }
+        return *this;
+    }
+
+    T& operator[](size_t pos) {
+        if (pos >= Size()) {
+            throw std::out_of_range("MappedVector access out of range");
+        }
+        return Data()[pos];
+    }
+
+    T& Front() noexcept {
+        return Data()[0];
+    }
+
+    const T& Front() const noexcept {
+        return Data()[0];
+    }
+
+    T& Back() noexcept {
+        return Data()[Size() - 1];
+    }
+
+    const T& Back() const noexcept {
+        return Data()[Size() - 1];
+    }
+
+    T* Data() const noexcept {
+        return header_ ? reinterpret_cast<T*>(header_ + 1) : nullptr;
+    }
+
+    bool IsEmpty() const noexcept {
+        return Size() == 0;
+    }
+
+    // A moved-from vector is detached from its file and stays empty.
+    size_t Size() const noexcept {
+        return header_ ? header_->size : 0;
+    }
+
+    size_t Capacity() const noexcept {
+        return capacity_;
+    }
+
+    void Reserve(size_t new_cap) {
+        if (new_cap > capacity_) {
+            Remap(new_cap);
+        }
+    }
+
+    void Clear() noexcept {
+        if (header_) {
+            header_->size = 0;
+        }
+    }
+
+    void PushBack(const T& value) {
+        if (Size() >= capacity_) {
+            // value may live in the mapping that Remap is about to move.
+            T copy = value;
+            Remap(GrowthPolicy::NextCapacity(capacity_, Size() + 1, sizeof(T)));
+            Data()[header_->size++] = copy;
+            return;
+        }
+        Data()[header_->size++] = value;
+    }
+
+    void Append(const T* values, size_t count) {
+        if (count == 0) {
+            return;
+        }
+        if (Size() + count > capacity_) {
+            // Values inside the mapping move with it, so keep their offset across the remap.
+            bool aliased = values >= Data() && values < Data() + capacity_;
+            size_t offset = aliased ? values - Data() : 0;
+            Remap(GrowthPolicy::NextCapacity(capacity_, Size() + count, sizeof(T)));
+            if (aliased) {
+                values = Data() + offset;
+            }
+        }
+        std::memmove(static_cast<void*>(Data() + Size()), static_cast<const void*>(values), count * sizeof(T));
+        header_->size += count;
+    }
+
+    void PopBack() noexcept {
+        if (Size() > 0) {
+            --header_->size;
+        }
+    }
+
+    void Resize(size_t count, const T& value) {
+        if (count > capacity_) {
+            Remap(GrowthPolicy::NextCapacity(capacity_, count, sizeof(T)));
+        }
+        if (!header_) {
+            return;
+        }
+        for (size_t i = Size(); i < count; ++i) {
+            Data()[i] = value;
+        }
+        header_->size = count;
+    }
+
+    void Advise(MappedAccess access) {
+        access_ = access;
+        if (header_) {
+            madvise(header_, MappedBytes(capacity_), AdviceFor(access_));
+        }
+    }
+
+    // Writes dirty pages back to the file. The kernel does it eventually without this call.
+    void Sync() {
+        if (header_ && msync(header_, MappedBytes(capacity_), MS_SYNC) != 0) {
+            throw std::system_error(errno, std::generic_category(), "MappedVector msync");
+        }
+    }
+
+    ~MappedVector() {
+        Unmap();
+    }
+
+private:
+    static constexpr uint64_t MAGIC = 0x524f544345564d4dULL;
+
+    struct alignas(64) Header {
+        uint64_t magic;
+        uint64_t elem_size;
+        uint64_t size;
+    };
+
+    static size_t MappedBytes(size_t capacity) noexcept {
+        return sizeof(Header) + capacity * sizeof(T);
+    }
+
+    static int AdviceFor(MappedAccess access) noexcept {
+        switch (access) {
+            case MappedAccess::SEQUENTIAL:
+                return MADV_SEQUENTIAL;
+            case MappedAccess::RANDOM:
+                return MADV_RANDOM;
+            case MappedAccess::WILL_NEED:
+                return MADV_WILLNEED;
+            default:
+                return MADV_NORMAL;
+        }
+    }
+
+    // Maps a file of file_bytes bytes, extending it first to hold at least capacity elements.
+    void Map(size_t file_bytes, size_t capacity) {
+        if (MappedBytes(capacity) > file_bytes && ftruncate(fd_, MappedBytes(capacity)) != 0) {
+            throw std::system_error(errno, std::generic_category(), "MappedVector ftruncate");
+        }
+        void* ptr = mmap(nullptr, MappedBytes(capacity), PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (ptr == MAP_FAILED) {
+            throw std::system_error(errno, std::generic_category(), "MappedVector mmap");
+        }
+        header_ = static_cast<Header*>(ptr);
+        capacity_ = capacity;
+        madvise(header_, MappedBytes(capacity_), AdviceFor(access_));
+    }
+
+    void Remap(size_t new_cap) {
+        if (!header_) {
+            throw std::logic_error("MappedVector is not attached to a file");
+        }
+        if (ftruncate(fd_, MappedBytes(new_cap)) != 0) {
+            throw std::system_error(errno, std::generic_category(), "MappedVector ftruncate");
+        }
+        void* ptr = mremap(header_, MappedBytes(capacity_), MappedBytes(new_cap), MREMAP_MAYMOVE);
+        if (ptr == MAP_FAILED) {
+            throw std::system_error(errno, std::generic_category(), "MappedVector mremap");
+        }
+        header_ = static_cast<Header*>(ptr);
+        capacity_ = new_cap;
+        madvise(header_, MappedBytes(capacity_), AdviceFor(access_));
+    }
+
+    void Unmap() noexcept {
+        if (header_) {
+            munmap(header_, MappedBytes(capacity_));
+            header_ = nullptr;
+        }
+        if (fd_ >= 0) {
+            close(fd_);
+            fd_ = -1;
+        }
+        capacity_ = 0;
+    }
+
+    int fd_;
+    Header* header_;
+    size_t capacity_;
+    MappedAccess access_;
+};
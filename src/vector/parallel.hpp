@@ -0,0 +1,242 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "vector.hpp"
+
+class ThreadPool {
+public:
+    explicit ThreadPool(size_t workers = std::max(1u, std::thread::hardware_concurrency()))
+        : worker_count_(std::max<size_t>(workers, 1)), generation_(0), task_count_(0), pending_(0), stop_(false) {
+        for (size_t i = 1; i < worker_count_; ++i) {
+            threads_.emplace_back([this] { WorkerLoop(); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    static ThreadPool& Default() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    size_t WorkerCount() const noexcept {
+        return worker_count_;
+    }
+
+    // Runs task(0) ... task(count - 1) on the workers and the calling thread, blocks until all are done.
+    // If tasks throw, the remaining ones are skipped and the first exception is rethrown here once
+    // every thread has left the task. A Run issued from inside a task of this pool runs serially.
+    void Run(size_t count, const std::function<void(size_t)>& task) {
+        if (count == 0) {
+            return;
+        }
+        if (worker_count_ == 1 || count == 1 || active_pool_ == this) {
+            for (size_t i = 0; i < count; ++i) {
+                task(i);
+            }
+            return;
+        }
+        std::lock_guard<std::mutex> run_lock(run_mutex_);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_ = &task;
+            task_count_ = count;
+            next_task_.store(0);
+            pending_ = threads_.size();
+            error_ = nullptr;
+            ++generation_;
+        }
+        wake_.notify_all();
+        active_pool_ = this;
+        Work(task, count);
+        active_pool_ = nullptr;
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return pending_ == 0; });
+        task_ = nullptr;
+        if (error_) {
+            std::rethrow_exception(std::exchange(error_, nullptr));
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+    }
+
+private:
+    void WorkerLoop() {
+        active_pool_ = this;
+        size_t seen_generation = 0;
+        while (true) {
+            const std::function<void(size_t)>* task;
+            size_t count;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [&] { return stop_ || generation_ != seen_generation; });
+                if (stop_) {
+                    return;
+                }
+                seen_generation = generation_;
+                task = task_;
+                count = task_count_;
+            }
+            Work(*task, count);
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                --pending_;
+            }
+            done_.notify_one();
+        }
+    }
+
+    void Work(const std::function<void(size_t)>& task, size_t count) {
+        for (size_t i = next_task_.fetch_add(1); i < count; i = next_task_.fetch_add(1)) {
+            try {
+                task(i);
+            } catch (...) {
+                next_task_.store(count);
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!error_) {
+                    error_ = std::current_exception();
+                }
+            }
+        }
+    }
+
+    static inline thread_local const ThreadPool* active_pool_ = nullptr;
+
+    size_t worker_count_;
+    std::vector<std::thread> threads_;
+    std::mutex run_mutex_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    const std::function<void(size_t)>* task_ = nullptr;
+    size_t generation_;
+    size_t task_count_;
+    size_t pending_;
+    std::atomic<size_t> next_task_;
+    std::exception_ptr error_;
+    bool stop_;
+};
+
+namespace parallel_detail {
+const size_t MIN_CHUNK = 1 << 14;
+
+inline size_t ChunkCount(size_t size, const ThreadPool& pool) {
+    size_t by_grain = (size + MIN_CHUNK - 1) / MIN_CHUNK;
+    return std::max<size_t>(1, std::min(by_grain, 4 * pool.WorkerCount()));
+}
+
+template <typename F>
+void ForEachChunk(size_t size, ThreadPool& pool, F chunk_fn) {
+    size_t chunks = ChunkCount(size, pool);
+    pool.Run(chunks, [&](size_t chunk) { chunk_fn(chunk, size * chunk / chunks, size * (chunk + 1) / chunks); });
+}
+}  // namespace parallel_detail
+
+template <typename T, typename... Options, typename F>
+void ParallelForEach(Vector<T, Options...>& vec, F fn, ThreadPool& pool = ThreadPool::Default()) {
+    T* data = vec.Data();
+    parallel_detail::ForEachChunk(vec.Size(), pool, [&](size_t, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            fn(data[i]);
+        }
+    });
+}
+
+template <typename T, typename... Options>
+void ParallelFill(Vector<T, Options...>& vec, const T& value, ThreadPool& pool = ThreadPool::Default()) {
+    T* data = vec.Data();
+    parallel_detail::ForEachChunk(vec.Size(), pool, [&](size_t, size_t begin, size_t end) {
+        std::fill(data + begin, data + end, value);
+    });
+}
+
+// dst is resized to src.Size() and receives fn(src[i]).
+template <typename T, typename... OptionsT, typename U, typename... OptionsU, typename F>
+void ParallelTransform(const Vector<T, OptionsT...>& src, Vector<U, OptionsU...>& dst, F fn,
+                       ThreadPool& pool = ThreadPool::Default()) {
+    dst.Resize(src.Size(), U{});
+    const T* in = src.Data();
+    U* out = dst.Data();
+    parallel_detail::ForEachChunk(src.Size(), pool, [&](size_t, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            out[i] = fn(in[i]);
+        }
+    });
+}
+
+// op must be associative; partial results are combined in chunk order.
+template <typename T, typename... Options, typename R, typename Op = std::plus<>>
+R ParallelReduce(const Vector<T, Options...>& vec, R init, Op op = Op(),
+                 ThreadPool& pool = ThreadPool::Default()) {
+    const T* data = vec.Data();
+    size_t chunks = parallel_detail::ChunkCount(vec.Size(), pool);
+    std::vector<R> partial(chunks, init);
+    std::vector<char> touched(chunks, false);
+    pool.Run(chunks, [&](size_t chunk) {
+        size_t begin = vec.Size() * chunk / chunks;
+        size_t end = vec.Size() * (chunk + 1) / chunks;
+        if (begin == end) {
+            return;
+        }
+        R acc = data[begin];
+        for (size_t i = begin + 1; i < end; ++i) {
+            acc = op(acc, data[i]);
+        }
+        partial[chunk] = acc;
+        touched[chunk] = true;
+    });
+    R result = init;
+    for (size_t chunk = 0; chunk < chunks; ++chunk) {
+        if (touched[chunk]) {
+            result = op(result, partial[chunk]);
+        }
+    }
+    return result;
+}
+
+// Parallel merge sort: chunks are sorted independently, then neighbouring runs are merged
+// pairwise, each round in parallel.
+template <typename T, typename... Options, typename Compare = std::less<>>
+void ParallelSort(Vector<T, Options...>& vec, Compare comp = Compare(),
+                  ThreadPool& pool = ThreadPool::Default()) {
+    T* data = vec.Data();
+    size_t size = vec.Size();
+    size_t chunks = parallel_detail::ChunkCount(size, pool);
+    std::vector<size_t> bounds(chunks + 1);
+    for (size_t chunk = 0; chunk <= chunks; ++chunk) {
+        bounds[chunk] = size * chunk / chunks;
+    }
+    pool.Run(chunks, [&](size_t chunk) { std::sort(data + bounds[chunk], data + bounds[chunk + 1], comp); });
+    for (size_t width = 1; width < chunks; width *= 2) {
+        size_t merges = (chunks + 2 * width - 1) / (2 * width);
+        pool.Run(merges, [&](size_t merge) {
+            size_t left = merge * 2 * width;
+            size_t mid = std::min(left + width, chunks);
+            size_t right = std::min(left + 2 * width, chunks);
+            if (mid < right) {
+                std::inplace_merge(data + bounds[left], data + bounds[mid], data + bounds[right], comp);
+            }
+        });
+    }
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "parallel.hpp"
+#include "vector.hpp"
+
+struct IdentityKey {
+    template <typename T>
+    const T& operator()(const T& value) const noexcept {
+        return value;
+    }
+};
+
+// Maps a key to an unsigned integer with the same ordering: the sign bit of signed
+// integers is flipped, negative floats have all bits inverted and positive ones the sign bit set.
+template <typename K>
+auto RadixKeyBits(K key) noexcept {
+    static_assert(std::is_arithmetic_v<K> && !std::is_same_v<K, bool>, "Radix keys must be integers or floats");
+    if constexpr (std::is_floating_point_v<K>) {
+        static_assert(sizeof(K) == 4 || sizeof(K) == 8, "Only float and double keys are supported");
+        using Bits = std::conditional_t<sizeof(K) == 4, uint32_t, uint64_t>;
+        Bits bits;
+        std::memcpy(&bits, &key, sizeof(bits));
+        Bits sign = Bits(1) << (8 * sizeof(Bits) - 1);
+        return static_cast<Bits>((bits & sign) ? ~bits : bits | sign);
+    } else if constexpr (std::is_signed_v<K>) {
+        using Bits = std::make_unsigned_t<K>;
+        return static_cast<Bits>(static_cast<Bits>(key) ^ (Bits(1) << (8 * sizeof(Bits) - 1)));
+    } else {
+        return key;
+    }
+}
+
+namespace radix_detail {
+const size_t DIGIT_BITS = 8;
+const size_t BUCKETS = size_t(1) << DIGIT_BITS;
+const size_t PREFETCH_DISTANCE = 64;
+
+inline void Prefetch([[maybe_unused]] const void* ptr) noexcept {
+#if defined(__GNUC__)
+    __builtin_prefetch(ptr);
+#endif
+}
+}  // namespace radix_detail
+
+// Stable LSD radix sort by key(element), one byte per pass. Passes where every element
+// has the same digit are skipped. With a pool each pass counts and scatters chunks in
+// parallel, the per-chunk offsets keeping the result stable.
+template <typename T, typename... Options, typename KeyFn = IdentityKey>
+void RadixSort(Vector<T, Options...>& vec, KeyFn key = KeyFn(), ThreadPool* pool = nullptr) {
+    static_assert(std::is_trivially_copyable_v<T>, "RadixSort copies elements bytewise through a scratch buffer");
+    using namespace radix_detail;
+    size_t size = vec.Size();
+    if (size < 2) {
+        return;
+    }
+    using Bits = decltype(RadixKeyBits(key(vec.Data()[0])));
+    Vector<T> scratch;
+    scratch.Reserve(size);
+    T* src = vec.Data();
+    T* dst = scratch.Data();
+
+    size_t chunks = pool ? parallel_detail::ChunkCount(size, *pool) : 1;
+    std::vector<std::array<size_t, BUCKETS>> counts(chunks);
+    auto for_each_chunk = [&](auto chunk_fn) {
+        auto run = [&](size_t chunk) { chunk_fn(chunk, size * chunk / chunks, size * (chunk + 1) / chunks); };
+        if (pool) {
+            pool->Run(chunks, run);
+        } else {
+            run(0);
+        }
+    };
+
+    for (size_t shift = 0; shift < 8 * sizeof(Bits); shift += DIGIT_BITS) {
+        auto digit = [&](const T& value) { return (RadixKeyBits(key(value)) >> shift) & (BUCKETS - 1); };
+        for_each_chunk([&](size_t chunk, size_t begin, size_t end) {
+            auto& count = counts[chunk];
+            count.fill(0);
+            for (size_t i = begin; i < end; ++i) {
+                ++count[digit(src[i])];
+            }
+        });
+        bool trivial = false;
+        size_t offset = 0;
+        for (size_t bucket = 0; bucket < BUCKETS; ++bucket) {
+            size_t start = offset;
+            for (auto& count : counts) {
+                size_t n = count[bucket];
+                count[bucket] = offset;
+                offset += n;
+            }
+            trivial |= offset - start == size;
+        }
+        if (trivial) {
+            continue;
+        }
+        for_each_chunk([&](size_t chunk, size_t begin, size_t end) {
+            auto& next = counts[chunk];
+            for (size_t i = begin; i < end; ++i) {
+                if (i + PREFETCH_DISTANCE < end) {
+                    Prefetch(src + i + PREFETCH_DISTANCE);
+                }
+                dst[next[digit(src[i])]++] = src[i];
+            }
+        });
+        std::swap(src, dst);
+    }
+    if (src != vec.Data()) {
+        std::memcpy(static_cast<void*>(vec.Data()), static_cast<const void*>(src), size * sizeof(T));
+    }
+}
+
+template <typename T, typename... Options, typename KeyFn = IdentityKey>
+void ParallelRadixSort(Vector<T, Options...>& vec, KeyFn key = KeyFn(), ThreadPool& pool = ThreadPool::Default()) {
+    RadixSort(vec, key, &pool);
+}
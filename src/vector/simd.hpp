@@ -0,0 +1,569 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "vector.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define VECTOR_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+enum class SimdLevel { SCALAR, SSE2, AVX2, AVX512 };
+
+inline SimdLevel DetectSimdLevel() {
+    static const SimdLevel level = [] {
+#ifdef VECTOR_SIMD_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return SimdLevel::AVX512;
+        }
+        if (__builtin_cpu_supports("avx2")) {
+            return SimdLevel::AVX2;
+        }
+        if (__builtin_cpu_supports("sse2")) {
+            return SimdLevel::SSE2;
+        }
+#endif
+        return SimdLevel::SCALAR;
+    }();
+    return level;
+}
+
+namespace simd_detail {
+
+template <typename T>
+size_t FindScalar(const T* data, size_t size, T value) {
+    return std::find(data, data + size, value) - data;
+}
+
+template <typename T>
+size_t CountScalar(const T* data, size_t size, T value) {
+    return std::count(data, data + size, value);
+}
+
+template <typename T>
+T SumScalar(const T* data, size_t size) {
+    return std::accumulate(data, data + size, T{});
+}
+
+template <typename T>
+std::pair<T, T> MinMaxScalar(const T* data, size_t size) {
+    auto [min, max] = std::minmax_element(data, data + size);
+    return {*min, *max};
+}
+
+#ifdef VECTOR_SIMD_X86
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+// Each Ops struct wraps one register width for one element type. The kernels below are
+// written once against this interface and instantiated inside per-ISA target functions.
+template <SimdLevel Level, typename T>
+struct Ops;
+
+template <>
+struct Ops<SimdLevel::SSE2, int32_t> {
+    using Reg = __m128i;
+    static constexpr size_t LANES = 4;
+
+    [[gnu::target("sse2")]] static Reg Load(const int32_t* p) {
+        return _mm_loadu_si128(reinterpret_cast<const Reg*>(p));
+    }
+
+    [[gnu::target("sse2")]] static void Store(int32_t* p, Reg a) {
+        _mm_storeu_si128(reinterpret_cast<Reg*>(p), a);
+    }
+
+    [[gnu::target("sse2")]] static Reg Set1(int32_t v) {
+        return _mm_set1_epi32(v);
+    }
+
+    [[gnu::target("sse2")]] static uint64_t EqMask(Reg a, Reg b) {
+        return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b)));
+    }
+
+    [[gnu::target("sse2")]] static Reg Add(Reg a, Reg b) {
+        return _mm_add_epi32(a, b);
+    }
+
+    [[gnu::target("sse2")]] static Reg Min(Reg a, Reg b) {
+        Reg gt = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+    }
+
+    [[gnu::target("sse2")]] static Reg Max(Reg a, Reg b) {
+        Reg gt = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+    }
+};
+
+template <>
+struct Ops<SimdLevel::SSE2, float> {
+    using Reg = __m128;
+    static constexpr size_t LANES = 4;
+
+    [[gnu::target("sse2")]] static Reg Load(const float* p) {
+        return _mm_loadu_ps(p);
+    }
+
+    [[gnu::target("sse2")]] static void Store(float* p, Reg a) {
+        _mm_storeu_ps(p, a);
+    }
+
+    [[gnu::target("sse2")]] static Reg Set1(float v) {
+        return _mm_set1_ps(v);
+    }
+
+    [[gnu::target("sse2")]] static uint64_t EqMask(Reg a, Reg b) {
+        return _mm_movemask_ps(_mm_cmpeq_ps(a, b));
+    }
+
+    [[gnu::target("sse2")]] static Reg Add(Reg a, Reg b) {
+        return _mm_add_ps(a, b);
+    }
+
+    [[gnu::target("sse2")]] static Reg Min(Reg a, Reg b) {
+        return _mm_min_ps(a, b);
+    }
+
+    [[gnu::target("sse2")]] static Reg Max(Reg a, Reg b) {
+        return _mm_max_ps(a, b);
+    }
+};
+
+template <>
+struct Ops<SimdLevel::SSE2, double> {
+    using Reg = __m128d;
+    static constexpr size_t LANES = 2;
+
+    [[gnu::target("sse2")]] static Reg Load(const double* p) {
+        return _mm_loadu_pd(p);
+    }
+
+    [[gnu::target("sse2")]] static void Store(double* p, Reg a) {
+        _mm_storeu_pd(p, a);
+    }
+
+    [[gnu::target("sse2")]] static Reg Set1(double v) {
+        return _mm_set1_pd(v);
+    }
+
+    [[gnu::target("sse2")]] static uint64_t EqMask(Reg a, Reg b) {
+        return _mm_movemask_pd(_mm_cmpeq_pd(a, b));
+    }
+
+    [[gnu::target("sse2")]] static Reg Add(Reg a, Reg b) {
+        return _mm_add_pd(a, b);
+    }
+
+    [[gnu::target("sse2")]] static Reg Min(Reg a, Reg b) {
+        return _mm_min_pd(a, b);
+    }
+
+    [[gnu::target("sse2")]] static Reg Max(Reg a, Reg b) {
+        return _mm_max_pd(a, b);
+    }
+};
+
+template <>
+struct Ops<SimdLevel::AVX2, int32_t> {
+    using Reg = __m256i;
+    static constexpr size_t LANES = 8;
+
+    [[gnu::target("avx2")]] static Reg Load(const int32_t* p) {
+        return _mm256_loadu_si256(reinterpret_cast<const Reg*>(p));
+    }
+
+    [[gnu::target("avx2")]] static void Store(int32_t* p, Reg a) {
+        _mm256_storeu_si256(reinterpret_cast<Reg*>(p), a);
+    }
+
+    [[gnu::target("avx2")]] static Reg Set1(int32_t v) {
+        return _mm256_set1_epi32(v);
+    }
+
+    [[gnu::target("avx2")]] static uint64_t EqMask(Reg a, Reg b) {
+        return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))));
+    }
+
+    [[gnu::target("avx2")]] static Reg Add(Reg a, Reg b) {
+        return _mm256_add_epi32(a, b);
+    }
+
+    [[gnu::target("avx2")]] static Reg Min(Reg a, Reg b) {
+        return _mm256_min_epi32(a, b);
+    }
+
+    [[gnu::target("avx2")]] static Reg Max(Reg a, Reg b) {
+        return _mm256_max_epi32(a, b);
+    }
+};
+
+template <>
+struct Ops<SimdLevel::AVX2, float> {
+    using Reg = __m256;
+    static constexpr size_t LANES = 8;
+
+    [[gnu::target("avx2")]] static Reg Load(const float* p) {
+        return _mm256_loadu_ps(p);
+    }
+
+    [[gnu::target("avx2")]] static void Store(float* p, Reg a) {
+        _mm256_storeu_ps(p, a);
+    }
+
+    [[gnu::target("avx2")]] static Reg Set1(float v) {
+        return _mm256_set1_ps(v);
+    }
+
+    [[gnu::target("avx2")]] static uint64_t EqMask(Reg a, Reg b) {
+        return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)));
+    }
+
+    [[gnu::target("avx2")]] static Reg Add(Reg a, Reg b) {
+        return _mm256_add_ps(a, b);
+    }
+
+    [[gnu::target("avx2")]] static Reg Min(Reg a, Reg b) {
+        return _mm256_min_ps(a, b);
+    }
+
+    [[gnu::target("avx2")]] static Reg Max(Reg a, Reg b) {
+        return _mm256_max_ps(a, b);
+    }
+};
+
+template <>
+struct Ops<SimdLevel::AVX2, double> {
+    using Reg = __m256d;
+    static constexpr size_t LANES = 4;
+
+    [[gnu::target("avx2")]] static Reg Load(const double* p) {
+        return _mm256_loadu_pd(p);
+    }
+
+    [[gnu::target("avx2")]] static void Store(double* p, Reg a) {
+        _mm256_storeu_pd(p, a);
+    }
+
+    [[gnu::target("avx2")]] static Reg Set1(double v) {
+        return _mm256_set1_pd(v);
+    }
+
+    [[gnu::target("avx2")]] static uint64_t EqMask(Reg a, Reg b) {
+        return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)));
+    }
+
+    [[gnu::target("avx2")]] static Reg Add(Reg a, Reg b) {
+        return _mm256_add_pd(a, b);
+    }
+
+    [[gnu::target("avx2")]] static Reg Min(Reg a, Reg b) {
+        return _mm256_min_pd(a, b);
+    }
+
+    [[gnu::target("avx2")]] static Reg Max(Reg a, Reg b) {
+        return _mm256_max_pd(a, b);
+    }
+};
+
+template <>
+struct Ops<SimdLevel::AVX512, int32_t> {
+    using Reg = __m512i;
+    static constexpr size_t LANES = 16;
+
+    [[gnu::target("avx512f")]] static Reg Load(const int32_t* p) {
+        return _mm512_loadu_si512(p);
+    }
+
+    [[gnu::target("avx512f")]] static void Store(int32_t* p, Reg a) {
+        _mm512_storeu_si512(p, a);
+    }
+
+    [[gnu::target("avx512f")]] static Reg Set1(int32_t v) {
+        return _mm512_set1_epi32(v);
+    }
+
+    [[gnu::target("avx512f")]] static uint64_t EqMask(Reg a, Reg b) {
+        return _mm512_cmpeq_epi32_mask(a, b);
+    }
+
+    [[gnu::target("avx512f")]] static Reg Add(Reg a, Reg b) {
+        return _mm512_add_epi32(a, b);
+    }
+
+    [[gnu::target("avx512f")]] static Reg Min(Reg a, Reg b) {
+        return _mm512_min_epi32(a, b);
+    }
+
+    [[gnu::target("avx512f")]] static Reg Max(Reg a, Reg b) {
+        return _mm512_max_epi32(a, b);
+    }
+};
+
+template <>
+struct Ops<SimdLevel::AVX512, float> {
+    using Reg = __m512;
+    static constexpr size_t LANES = 16;
+
+    [[gnu::target("avx512f")]] static Reg Load(const float* p) {
+        return _mm512_loadu_ps(p);
+    }
+
+    [[gnu::target("avx512f")]] static void Store(float* p, Reg a) {
+        _mm512_storeu_ps(p, a);
+    }
+
+    [[gnu::target("avx512f")]] static Reg Set1(float v) {
+        return _mm512_set1_ps(v);
+    }
+
+    [[gnu::target("avx512f")]] static uint64_t EqMask(Reg a, Reg b) {
+        return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ);
+    }
+
+    [[gnu::target("avx512f")]] static Reg Add(Reg a, Reg b) {
+        return _mm512_add_ps(a, b);
+    }
+
+    [[gnu::target("avx512f")]] static Reg Min(Reg a, Reg b) {
+        return _mm512_min_ps(a, b);
+    }
+
+    [[gnu::target("avx512f")]] static Reg Max(Reg a, Reg b) {
+        return _mm512_max_ps(a, b);
+    }
+};
+
+template <>
+struct Ops<SimdLevel::AVX512, double> {
+    using Reg = __m512d;
+    static constexpr size_t LANES = 8;
+
+    [[gnu::target("avx512f")]] static Reg Load(const double* p) {
+        return _mm512_loadu_pd(p);
+    }
+
+    [[gnu::target("avx512f")]] static void Store(double* p, Reg a) {
+        _mm512_storeu_pd(p, a);
+    }
+
+    [[gnu::target("avx512f")]] static Reg Set1(double v) {
+        return _mm512_set1_pd(v);
+    }
+
+    [[gnu::target("avx512f")]] static uint64_t EqMask(Reg a, Reg b) {
+        return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ);
+    }
+
+    [[gnu::target("avx512f")]] static Reg Add(Reg a, Reg b) {
+        return _mm512_add_pd(a, b);
+    }
+
+    [[gnu::target("avx512f")]] static Reg Min(Reg a, Reg b) {
+        return _mm512_min_pd(a, b);
+    }
+
+    [[gnu::target("avx512f")]] static Reg Max(Reg a, Reg b) {
+        return _mm512_max_pd(a, b);
+    }
+};
+
+template <typename O, typename T>
+[[gnu::always_inline]] inline size_t FindKernel(const T* data, size_t size, T value) {
+    typename O::Reg needle = O::Set1(value);
+    size_t i = 0;
+    for (; i + O::LANES <= size; i += O::LANES) {
+        uint64_t mask = O::EqMask(O::Load(data + i), needle);
+        if (mask) {
+            return i + __builtin_ctzll(mask);
+        }
+    }
+    return i + FindScalar(data + i, size - i, value);
+}
+
+template <typename O, typename T>
+[[gnu::always_inline]] inline size_t CountKernel(const T* data, size_t size, T value) {
+    typename O::Reg needle = O::Set1(value);
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + O::LANES <= size; i += O::LANES) {
+        count += __builtin_popcountll(O::EqMask(O::Load(data + i), needle));
+    }
+    return count + CountScalar(data + i, size - i, value);
+}
+
+template <typename O, typename T>
+[[gnu::always_inline]] inline T SumKernel(const T* data, size_t size) {
+    typename O::Reg acc[4] = {O::Set1(T{}), O::Set1(T{}), O::Set1(T{}), O::Set1(T{})};
+    size_t i = 0;
+    for (; i + 4 * O::LANES <= size; i += 4 * O::LANES) {
+        for (size_t k = 0; k < 4; ++k) {
+            acc[k] = O::Add(acc[k], O::Load(data + i + k * O::LANES));
+        }
+    }
+    for (; i + O::LANES <= size; i += O::LANES) {
+        acc[0] = O::Add(acc[0], O::Load(data + i));
+    }
+    T lanes[O::LANES];
+    O::Store(lanes, O::Add(O::Add(acc[0], acc[1]), O::Add(acc[2], acc[3])));
+    return SumScalar(lanes, O::LANES) + SumScalar(data + i, size - i);
+}
+
+template <typename O, typename T>
+[[gnu::always_inline]] inline std::pair<T, T> MinMaxKernel(const T* data, size_t size) {
+    if (size < O::LANES) {
+        return MinMaxScalar(data, size);
+    }
+    typename O::Reg min = O::Load(data);
+    typename O::Reg max = min;
+    size_t i = O::LANES;
+    for (; i + O::LANES <= size; i += O::LANES) {
+        typename O::Reg chunk = O::Load(data + i);
+        min = O::Min(min, chunk);
+        max = O::Max(max, chunk);
+    }
+    T lanes[O::LANES];
+    O::Store(lanes, min);
+    T result_min = *std::min_element(lanes, lanes + O::LANES);
+    O::Store(lanes, max);
+    T result_max = *std::max_element(lanes, lanes + O::LANES);
+    for (; i < size; ++i) {
+        result_min = std::min(result_min, data[i]);
+        result_max = std::max(result_max, data[i]);
+    }
+    return {result_min, result_max};
+}
+
+template <SimdLevel Level>
+struct Kernels;
+
+#define VECTOR_SIMD_KERNELS(LEVEL, TARGET)                                                       \
+    template <>                                                                                  \
+    struct Kernels<LEVEL> {                                                                      \
+        template <typename T>                                                                    \
+        [[gnu::target(TARGET)]] static size_t Find(const T* data, size_t size, T value) {        \
+            return FindKernel<Ops<LEVEL, T>>(data, size, value);                                 \
+        }                                                                                        \
+        template <typename T>                                                                    \
+        [[gnu::target(TARGET)]] static size_t Count(const T* data, size_t size, T value) {       \
+            return CountKernel<Ops<LEVEL, T>>(data, size, value);                                \
+        }                                                                                        \
+        template <typename T>                                                                    \
+        [[gnu::target(TARGET)]] static T Sum(const T* data, size_t size) {                       \
+            return SumKernel<Ops<LEVEL, T>>(data, size);                                         \
+        }                                                                                        \
+        template <typename T>                                                                    \
+        [[gnu::target(TARGET)]] static std::pair<T, T> MinMax(const T* data, size_t size) {      \
+            return MinMaxKernel<Ops<LEVEL, T>>(data, size);                                      \
+        }                                                                                        \
+    };
+
+VECTOR_SIMD_KERNELS(SimdLevel::SSE2, "sse2")
+VECTOR_SIMD_KERNELS(SimdLevel::AVX2, "avx2")
+VECTOR_SIMD_KERNELS(SimdLevel::AVX512, "avx512f")
+
+#undef VECTOR_SIMD_KERNELS
+
+#pragma GCC diagnostic pop
+
+#endif
+
+template <typename T>
+constexpr bool HAS_KERNELS = std::is_same_v<T, int32_t> || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+#ifdef VECTOR_SIMD_X86
+#define VECTOR_SIMD_DISPATCH(LEVEL, NAME, ...)                        \
+    if constexpr (HAS_KERNELS<T>) {                                   \
+        switch (LEVEL) {                                              \
+            case SimdLevel::AVX512:                                   \
+                return Kernels<SimdLevel::AVX512>::NAME(__VA_ARGS__); \
+            case SimdLevel::AVX2:                                     \
+                return Kernels<SimdLevel::AVX2>::NAME(__VA_ARGS__);   \
+            case SimdLevel::SSE2:                                     \
+                return Kernels<SimdLevel::SSE2>::NAME(__VA_ARGS__);   \
+            case SimdLevel::SCALAR:                                   \
+                break;                                                \
+        }                                                             \
+    }
+#else
+#define VECTOR_SIMD_DISPATCH(LEVEL, NAME, ...)
+#endif
+
+template <typename T>
+size_t Find(SimdLevel level, const T* data, size_t size, T value) {
+    VECTOR_SIMD_DISPATCH(level, Find, data, size, value)
+    return FindScalar(data, size, value);
+}
+
+template <typename T>
+size_t Count(SimdLevel level, const T* data, size_t size, T value) {
+    VECTOR_SIMD_DISPATCH(level, Count, data, size, value)
+    return CountScalar(data, size, value);
+}
+
+template <typename T>
+T Sum(SimdLevel level, const T* data, size_t size) {
+    VECTOR_SIMD_DISPATCH(level, Sum, data, size)
+    return SumScalar(data, size);
+}
+
+template <typename T>
+std::pair<T, T> MinMax(SimdLevel level, const T* data, size_t size) {
+    if (size == 0) {
+        throw std::out_of_range("MinMax of an empty Vector");
+    }
+    VECTOR_SIMD_DISPATCH(level, MinMax, data, size)
+    return MinMaxScalar(data, size);
+}
+
+#undef VECTOR_SIMD_DISPATCH
+
+}  // namespace simd_detail
+
+// Vectorized scans for Vector of arithmetic types. int32_t, float and double run on
+// SSE2/AVX2/AVX-512 kernels picked at runtime, other types use the scalar algorithms.
+// SimdFind returns Size() when the value is absent. SimdSum follows std::accumulate's
+// overflow rules, so a signed integer total must fit in T; floating point sums may round
+// differently since lanes are summed independently. SimdMinMax does not order NaN the way
+// std::minmax_element does: with NaN present the result depends on its position and on
+// the SIMD level, so filter NaN out first when it matters.
+template <typename T, typename... Options>
+size_t SimdFind(const Vector<T, Options...>& vec, std::type_identity_t<T> value, SimdLevel level = DetectSimdLevel()) {
+    static_assert(std::is_arithmetic_v<T>, "SIMD kernels need an arithmetic type");
+    return simd_detail::Find(level, vec.Data(), vec.Size(), value);
+}
+
+template <typename T, typename... Options>
+bool SimdContains(const Vector<T, Options...>& vec, std::type_identity_t<T> value,
+                  SimdLevel level = DetectSimdLevel()) {
+    return SimdFind(vec, value, level) != vec.Size();
+}
+
+template <typename T, typename... Options>
+size_t SimdCount(const Vector<T, Options...>& vec, std::type_identity_t<T> value,
+                 SimdLevel level = DetectSimdLevel()) {
+    static_assert(std::is_arithmetic_v<T>, "SIMD kernels need an arithmetic type");
+    return simd_detail::Count(level, vec.Data(), vec.Size(), value);
+}
+
+template <typename T, typename... Options>
+T SimdSum(const Vector<T, Options...>& vec, SimdLevel level = DetectSimdLevel()) {
+    static_assert(std::is_arithmetic_v<T>, "SIMD kernels need an arithmetic type");
+    return simd_detail::Sum(level, vec.Data(), vec.Size());
+}
+
+template <typename T, typename... Options>
+std::pair<T, T> SimdMinMax(const Vector<T, Options...>& vec, SimdLevel level = DetectSimdLevel()) {
+    static_assert(std::is_arithmetic_v<T>, "SIMD kernels need an arithmetic type");
+    return simd_detail::MinMax(level, vec.Data(), vec.Size());
+}
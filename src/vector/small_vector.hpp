@@ -0,0 +1,209 @@
+#pragma once
+
+#include <algorithm>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include "vector.hpp"
+
+template <typename T, size_t N, typename Alloc = std::allocator<T>, typename GrowthPolicy = DoublingGrowth>
+class SmallVector {
+public:
+    static_assert(N > 0, "SmallVector needs at least one inline element");
+
+    SmallVector() : data_(InlineData()), size_(0), capacity_(N) {
+    }
+
+    SmallVector(size_t count, const T& value) : SmallVector() {
+        Resize(count, value);
+    }
+
+    SmallVector(const SmallVector& other) : SmallVector() {
+        Reserve(other.size_);
+        for (size_t i = 0; i < other.size_; ++i) {
+            std::allocator_traits<Alloc>::construct(allocator_, data_ + i, other.data_[i]);
+        }
+        size_ = other.size_;
+    }
+
+    SmallVector(SmallVector&& other) noexcept : SmallVector() {
+        Steal(other);
+    }
+
+    SmallVector(std::initializer_list<T> init) : SmallVector() {
+        Reserve(init.size());
+        for (const T& value : init) {
+            std::allocator_traits<Alloc>::construct(allocator_, data_ + size_++, value);
+        }
+    }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            SmallVector temp(other);
+            *this = std::move(temp);
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept {
+        if (this != &other) {
+            Clear();
+            Deallocate();
+            Steal(other);
+        }
+        return *this;
+    }
+
+    T& operator[](size_t pos) {
+        if (pos >= size_) {
+            throw std::out_of_range("SmallVector access out of range");
+        }
+        return data_[pos];
+    }
+
+    const T& Front() const noexcept {
+        return data_[0];
+    }
+
+    T& Back() const noexcept {
+        return data_[size_ - 1];
+    }
+
+    T* Data() const noexcept {
+        return data_;
+    }
+
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    bool IsInline() const noexcept {
+        return data_ == InlineData();
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept {
+        return capacity_;
+    }
+
+    void Reserve(size_t new_cap) {
+        if (new_cap <= capacity_) {
+            return;
+        }
+        T* new_data = allocator_.allocate(new_cap);
+        RelocateElements(allocator_, new_data, data_, size_);
+        Deallocate();
+        data_ = new_data;
+        capacity_ = new_cap;
+    }
+
+    void Clear() noexcept {
+        for (size_t i = 0; i < size_; ++i) {
+            std::allocator_traits<Alloc>::destroy(allocator_, data_ + i);
+        }
+        size_ = 0;
+    }
+
+    void Insert(size_t pos, T value) {
+        if (pos > size_) {
+            throw std::out_of_range("SmallVector insert out of range");
+        }
+        if (size_ >= capacity_) {
+            Reserve(GrowthPolicy::NextCapacity(capacity_, size_ + 1, sizeof(T)));
+        }
+        RelocateElements(allocator_, data_ + pos + 1, data_ + pos, size_ - pos);
+        std::allocator_traits<Alloc>::construct(allocator_, data_ + pos, std::move(value));
+        ++size_;
+    }
+
+    void Erase(size_t begin_pos, size_t end_pos) {
+        if (begin_pos >= size_ || begin_pos >= end_pos) {
+            return;
+        }
+        end_pos = std::min(end_pos, size_);
+        for (size_t i = begin_pos; i < end_pos; ++i) {
+            std::allocator_traits<Alloc>::destroy(allocator_, data_ + i);
+        }
+        RelocateElements(allocator_, data_ + begin_pos, data_ + end_pos, size_ - end_pos);
+        size_ -= end_pos - begin_pos;
+    }
+
+    void PushBack(T value) {
+        EmplaceBack(std::move(value));
+    }
+
+    template <class... Args>
+    void EmplaceBack(Args&&... args) {
+        if (size_ >= capacity_) {
+            Reserve(GrowthPolicy::NextCapacity(capacity_, size_ + 1, sizeof(T)));
+        }
+        std::allocator_traits<Alloc>::construct(allocator_, data_ + size_, std::forward<Args>(args)...);
+        ++size_;
+    }
+
+    void PopBack() {
+        if (size_ > 0) {
+            std::allocator_traits<Alloc>::destroy(allocator_, data_ + --size_);
+        }
+    }
+
+    void Resize(size_t count, const T& value) {
+        if (count < size_) {
+            for (size_t i = count; i < size_; ++i) {
+                std::allocator_traits<Alloc>::destroy(allocator_, data_ + i);
+            }
+        } else if (count > size_) {
+            if (count > capacity_) {
+                Reserve(GrowthPolicy::NextCapacity(capacity_, count, sizeof(T)));
+            }
+            for (size_t i = size_; i < count; ++i) {
+                std::allocator_traits<Alloc>::construct(allocator_, data_ + i, value);
+            }
+        }
+        size_ = count;
+    }
+
+    ~SmallVector() {
+        Clear();
+        Deallocate();
+    }
+
+private:
+    T* InlineData() const noexcept {
+        return reinterpret_cast<T*>(const_cast<unsigned char*>(inline_));
+    }
+
+    void Deallocate() noexcept {
+        if (!IsInline()) {
+            allocator_.deallocate(data_, capacity_);
+            data_ = InlineData();
+            capacity_ = N;
+        }
+    }
+
+    // Expects *this to be empty and inline.
+    void Steal(SmallVector& other) noexcept {
+        if (other.IsInline()) {
+            RelocateElements(allocator_, data_, other.data_, other.size_);
+            size_ = other.size_;
+        } else {
+            data_ = other.data_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.data_ = other.InlineData();
+            other.capacity_ = N;
+        }
+        other.size_ = 0;
+    }
+
+    Alloc allocator_;
+    T* data_;
+    size_t size_;
+    size_t capacity_;
+    alignas(T) unsigned char inline_[N * sizeof(T)];
+};
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "vector.hpp"
+
+// Structure of arrays: element i is the tuple of the i-th entries of one Vector per field,
+// so a scan over one field touches only that field's bytes. Column<I>() exposes a field
+// as a read-only Vector, which the SIMD kernels accept directly.
+template <typename... Ts>
+class SoAVector {
+public:
+    static_assert(sizeof...(Ts) > 0, "SoAVector needs at least one column");
+
+    template <size_t I>
+    using ColumnType = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+    SoAVector() = default;
+
+    bool IsEmpty() const noexcept {
+        return Size() == 0;
+    }
+
+    size_t Size() const noexcept {
+        return std::get<0>(columns_).Size();
+    }
+
+    template <size_t I>
+    const Vector<ColumnType<I>>& Column() const noexcept {
+        return std::get<I>(columns_);
+    }
+
+    template <size_t I>
+    ColumnType<I>* Data() const noexcept {
+        return std::get<I>(columns_).Data();
+    }
+
+    template <size_t I>
+    ColumnType<I>& Get(size_t pos) {
+        if (pos >= Size()) {
+            throw std::out_of_range("SoAVector access out of range");
+        }
+        return std::get<I>(columns_).Data()[pos];
+    }
+
+    std::tuple<Ts&...> operator[](size_t pos) {
+        if (pos >= Size()) {
+            throw std::out_of_range("SoAVector access out of range");
+        }
+        return std::apply([pos](auto&... column) { return std::tuple<Ts&...>(column.Data()[pos]...); }, columns_);
+    }
+
+    void Reserve(size_t new_cap) {
+        ForEachColumn([new_cap](auto& column) { column.Reserve(new_cap); });
+    }
+
+    void Clear() noexcept {
+        ForEachColumn([](auto& column) { column.Clear(); });
+    }
+
+    void PushBack(Ts... values) {
+        EmplaceBack(std::move(values)...);
+    }
+
+    template <class... Args>
+    void EmplaceBack(Args&&... args) {
+        static_assert(sizeof...(Args) == sizeof...(Ts), "EmplaceBack takes one value per column");
+        EmplaceColumns(std::index_sequence_for<Ts...>(), std::forward<Args>(args)...);
+    }
+
+    void PopBack() {
+        ForEachColumn([](auto& column) { column.PopBack(); });
+    }
+
+    void Erase(size_t begin_pos, size_t end_pos) {
+        ForEachColumn([=](auto& column) { column.Erase(begin_pos, end_pos); });
+    }
+
+    void SwapErase(size_t pos) {
+        ForEachColumn([pos](auto& column) { column.SwapErase(pos); });
+    }
+
+private:
+    template <typename F>
+    void ForEachColumn(F fn) {
+        std::apply([&fn](auto&... column) { (fn(column), ...); }, columns_);
+    }
+
+    // A throwing constructor in column k pops columns 0..k-1 again, so all columns keep one length.
+    template <size_t... Is, class... Args>
+    void EmplaceColumns(std::index_sequence<Is...>, Args&&... args) {
+        size_t appended = 0;
+        try {
+            ((std::get<Is>(columns_).EmplaceBack(std::forward<Args>(args)), ++appended), ...);
+        } catch (...) {
+            ((Is < appended ? std::get<Is>(columns_).PopBack() : void()), ...);
+            throw;
+        }
+    }
+
+    std::tuple<Vector<Ts>...> columns_;
+};
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Vector with a compile-time capacity whose elements live in an inline array, so it never
+// allocates and works in constant expressions. Slots past Size() hold default-constructed
+// values; for trivially copyable T the whole object is trivially copyable.
+template <typename T, size_t N>
+class StaticVector {
+public:
+    static_assert(std::is_default_constructible_v<T>, "StaticVector keeps default-constructed spare slots");
+
+    constexpr StaticVector() = default;
+
+    constexpr StaticVector(size_t count, const T& value) {
+        Resize(count, value);
+    }
+
+    constexpr StaticVector(std::initializer_list<T> init) {
+        Reserve(init.size());
+        for (const T& value : init) {
+            data_[size_++] = value;
+        }
+    }
+
+    constexpr T& operator[](size_t pos) {
+        CheckAccess(pos);
+        return data_[pos];
+    }
+
+    constexpr const T& operator[](size_t pos) const {
+        CheckAccess(pos);
+        return data_[pos];
+    }
+
+    constexpr T& At(size_t pos) {
+        return (*this)[pos];
+    }
+
+    constexpr const T& At(size_t pos) const {
+        return (*this)[pos];
+    }
+
+    constexpr const T& Front() const noexcept {
+        return data_[0];
+    }
+
+    constexpr T& Back() noexcept {
+        return data_[size_ - 1];
+    }
+
+    constexpr const T& Back() const noexcept {
+        return data_[size_ - 1];
+    }
+
+    constexpr T* Data() noexcept {
+        return data_;
+    }
+
+    constexpr const T* Data() const noexcept {
+        return data_;
+    }
+
+    constexpr bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    constexpr bool IsFull() const noexcept {
+        return size_ == N;
+    }
+
+    constexpr size_t Size() const noexcept {
+        return size_;
+    }
+
+    static constexpr size_t Capacity() noexcept {
+        return N;
+    }
+
+    constexpr void Reserve(size_t new_cap) const {
+        if (new_cap > N) {
+            throw std::length_error("StaticVector capacity exceeded");
+        }
+    }
+
+    constexpr void Clear() noexcept {
+        while (size_ > 0) {
+            data_[--size_] = T();
+        }
+    }
+
+    constexpr void Insert(size_t pos, T value) {
+        if (pos > size_) {
+            throw std::out_of_range("StaticVector insert out of range");
+        }
+        Reserve(size_ + 1);
+        for (size_t i = size_; i > pos; --i) {
+            data_[i] = std::move(data_[i - 1]);
+        }
+        data_[pos] = std::move(value);
+        ++size_;
+    }
+
+    constexpr void Erase(size_t begin_pos, size_t end_pos) {
+        if (begin_pos >= size_ || begin_pos >= end_pos) {
+            return;
+        }
+        end_pos = end_pos < size_ ? end_pos : size_;
+        size_t num_to_remove = end_pos - begin_pos;
+        for (size_t i = end_pos; i < size_; ++i) {
+            data_[i - num_to_remove] = std::move(data_[i]);
+        }
+        for (size_t i = size_ - num_to_remove; i < size_; ++i) {
+            data_[i] = T();
+        }
+        size_ -= num_to_remove;
+    }
+
+    constexpr void SwapErase(size_t pos) {
+        if (pos >= size_) {
+            return;
+        }
+        if (pos != size_ - 1) {
+            data_[pos] = std::move(data_[size_ - 1]);
+        }
+        PopBack();
+    }
+
+    constexpr void PushBack(T value) {
+        Reserve(size_ + 1);
+        data_[size_++] = std::move(value);
+    }
+
+    constexpr void Append(const T* values, size_t count) {
+        Reserve(size_ + count);
+        for (size_t i = 0; i < count; ++i) {
+            data_[size_++] = values[i];
+        }
+    }
+
+    template <class... Args>
+    constexpr void EmplaceBack(Args&&... args) {
+        Reserve(size_ + 1);
+        data_[size_++] = T(std::forward<Args>(args)...);
+    }
+
+    constexpr void PopBack() noexcept {
+        if (size_ > 0) {
+            data_[--size_] = T();
+        }
+    }
+
+    constexpr void Resize(size_t count, const T& value) {
+        Reserve(count);
+        while (size_ > count) {
+            PopBack();
+        }
+        while (size_ < count) {
+            data_[size_++] = value;
+        }
+    }
+
+private:
+    constexpr void CheckAccess(size_t pos) const {
+        if (pos >= size_) {
+            throw std::out_of_range("StaticVector access out of range");
+        }
+    }
+
+    T data_[N] = {};
+    size_t size_ = 0;
+};
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+#include "vector.hpp"
+
+// Strings stored back to back in one char Vector, string i spanning
+// [offsets[i], offsets[i + 1]). Offset bounds the total byte count; uint32_t halves the
+// offset array when the contents stay below 4 GiB.
+template <typename Offset = uint32_t>
+class StringVector {
+public:
+    static_assert(std::is_unsigned_v<Offset>, "Offsets must be unsigned");
+
+    StringVector() {
+        offsets_.PushBack(0);
+    }
+
+    std::string_view operator[](size_t pos) const {
+        if (pos >= Size()) {
+            throw std::out_of_range("StringVector access out of range");
+        }
+        const Offset* offsets = offsets_.Data();
+        return std::string_view(chars_.Data() + offsets[pos], offsets[pos + 1] - offsets[pos]);
+    }
+
+    std::string_view Back() const noexcept {
+        const Offset* offsets = offsets_.Data();
+        return std::string_view(chars_.Data() + offsets[Size() - 1], offsets[Size()] - offsets[Size() - 1]);
+    }
+
+    // All characters, without separators.
+    const char* Data() const noexcept {
+        return chars_.Data();
+    }
+
+    bool IsEmpty() const noexcept {
+        return Size() == 0;
+    }
+
+    size_t Size() const noexcept {
+        return offsets_.Size() - 1;
+    }
+
+    size_t Bytes() const noexcept {
+        return chars_.Size();
+    }
+
+    void Reserve(size_t strings, size_t bytes) {
+        offsets_.Reserve(strings + 1);
+        chars_.Reserve(bytes);
+    }
+
+    // Keeps both buffers allocated.
+    void Clear() noexcept {
+        chars_.Clear();
+        offsets_.Resize(1, 0);
+    }
+
+    void PushBack(std::string_view value) {
+        CheckBytes(value.size());
+        chars_.Append(value.data(), value.size());
+        offsets_.PushBack(static_cast<Offset>(chars_.Size()));
+    }
+
+    void PopBack() {
+        if (!IsEmpty()) {
+            offsets_.PopBack();
+            chars_.Resize(offsets_.Back(), '\0');
+        }
+    }
+
+    template <class InputIt>
+    void Append(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            PushBack(std::string_view(*first));
+        }
+    }
+
+    // Copies every string of other with one memcpy of its bytes and a rebased offset array.
+    // other may be *this: the count is taken and both buffers grown before anything is read.
+    template <typename OtherOffset>
+    void Append(const StringVector<OtherOffset>& other) {
+        size_t count = other.Size();
+        CheckBytes(other.Bytes());
+        Offset base = static_cast<Offset>(chars_.Size());
+        chars_.Append(other.Data(), other.Bytes());
+        offsets_.Reserve(offsets_.Size() + count);
+        const OtherOffset* other_offsets = other.offsets_.Data();
+        for (size_t i = 1; i <= count; ++i) {
+            offsets_.PushBack(base + static_cast<Offset>(other_offsets[i]));
+        }
+    }
+
+private:
+    template <typename OtherOffset>
+    friend class StringVector;
+
+    void CheckBytes(size_t extra) const {
+        if (extra > std::numeric_limits<Offset>::max() - chars_.Size()) {
+            throw std::length_error("StringVector offset overflow");
+        }
+    }
+
+    Vector<char> chars_;
+    Vector<Offset> offsets_;
+};
@@ -1,6 +1,25 @@
 #include "../vector.hpp"
 #include "../vector.cpp"
+#include "../bit_vector.hpp"
+#include "../compressed_vector.hpp"
+#include "../concurrent_vector.hpp"
+#include "../cow_vector.hpp"
+#include "../huge_page_allocator.hpp"
+#include "../incremental_vector.hpp"
+#include "../mapped_vector.hpp"
+#include "../parallel.hpp"
+#include "../radix_sort.hpp"
+#include "../simd.hpp"
+#include "../small_vector.hpp"
+#include "../soa_vector.hpp"
+#include "../static_vector.hpp"
+#include "../string_vector.hpp"
 
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <mutex>
+#include <numeric>
 #include <random>
 #include <vector>
 #include <string>
@@ -32,6 +51,34 @@ void ConstructRandomVector(std::vector<int>& vec, int sz) {
   }
 }
 
+struct ElementwiseInt {
+  ElementwiseInt(int v) : value(v) {}
+  ElementwiseInt(ElementwiseInt&& other) noexcept : value(other.value) {}
+  ~ElementwiseInt() {}
+
+  int value;
+};
+
+size_t allocation_count = 0;
+
+template <typename T>
+struct CountingAllocator : std::allocator<T> {
+  template <typename U>
+  struct rebind {
+    using other = CountingAllocator<U>;
+  };
+
+  CountingAllocator() = default;
+
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>&) {}
+
+  T* allocate(size_t n) {
+    ++allocation_count;
+    return std::allocator<T>::allocate(n);
+  }
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 void BM_CustomVectorPushBack(benchmark::State& state) {
   Vector<int> vec;
@@ -74,10 +121,814 @@ void BM_StdVectorMiddleInsert(benchmark::State& state) {
   state.SetComplexityN(state.range(0));
 }
 
+template <typename T>
+void BM_CustomVectorReserveRelocation(benchmark::State& state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    Vector<T> vec;
+    vec.Reserve(state.range(0));
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      vec.EmplaceBack(static_cast<int>(i));
+    }
+    state.ResumeTiming();
+    vec.Reserve(2 * state.range(0));
+    benchmark::DoNotOptimize(vec.Data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+  state.SetComplexityN(state.range(0));
+}
+
+template <typename T>
+void BM_CustomVectorFrontInsertErase(benchmark::State& state) {
+  Vector<T> vec;
+  vec.Reserve(state.range(0) + 1);
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    vec.EmplaceBack(static_cast<int>(i));
+  }
+  for (auto _ : state) {
+    vec.Insert(0, T(0));
+    vec.Erase(0, 1);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T) * 2);
+  state.SetComplexityN(state.range(0));
+}
+
+
+void BM_CustomVectorFreshEmplaceBack(benchmark::State& state) {
+  for (auto _ : state) {
+    Vector<int> vec;
+    for (int i = 0; i < state.range(0); ++i) {
+      vec.EmplaceBack(i);
+    }
+    benchmark::DoNotOptimize(vec.Data());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_CustomVectorFreshPushBack(benchmark::State& state) {
+  for (auto _ : state) {
+    Vector<int> vec;
+    for (int i = 0; i < state.range(0); ++i) {
+      vec.PushBack(i);
+    }
+    benchmark::DoNotOptimize(vec.Data());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_StdVectorFreshEmplaceBack(benchmark::State& state) {
+  for (auto _ : state) {
+    std::vector<int> vec;
+    for (int i = 0; i < state.range(0); ++i) {
+      vec.emplace_back(i);
+    }
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_StdVectorFreshPushBack(benchmark::State& state) {
+  for (auto _ : state) {
+    std::vector<int> vec;
+    for (int i = 0; i < state.range(0); ++i) {
+      vec.push_back(i);
+    }
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+template <typename Container>
+void BM_SmallSizeFill(benchmark::State& state) {
+  allocation_count = 0;
+  for (auto _ : state) {
+    Container vec;
+    for (int i = 0; i < state.range(0); ++i) {
+      vec.PushBack(i);
+    }
+    benchmark::DoNotOptimize(vec.Data());
+  }
+  state.counters["allocs_per_fill"] =
+      benchmark::Counter(static_cast<double>(allocation_count) / state.iterations());
+}
+
+void BM_CustomVectorBatchPushBack(benchmark::State& state) {
+  std::vector<int> batch(state.range(0), 1);
+  for (auto _ : state) {
+    Vector<int> vec;
+    for (int value : batch) {
+      vec.PushBack(value);
+    }
+    benchmark::DoNotOptimize(vec.Data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(int));
+}
+
+void BM_CustomVectorBatchAppend(benchmark::State& state) {
+  std::vector<int> batch(state.range(0), 1);
+  for (auto _ : state) {
+    Vector<int> vec;
+    vec.Append(batch.data(), batch.size());
+    benchmark::DoNotOptimize(vec.Data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(int));
+}
+
+void BM_StdVectorBatchInsert(benchmark::State& state) {
+  std::vector<int> batch(state.range(0), 1);
+  for (auto _ : state) {
+    std::vector<int> vec;
+    vec.insert(vec.end(), batch.begin(), batch.end());
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(int));
+}
+
+template <typename VectorType>
+void BM_VectorDoublingReserve(benchmark::State& state) {
+  VectorType vec;
+  vec.Resize(state.range(0), 1);
+  for (auto _ : state) {
+    vec.Reserve(vec.Capacity() * 2);
+    state.PauseTiming();
+    VectorType fresh;
+    fresh.Resize(state.range(0), 1);
+    vec = std::move(fresh);
+    state.ResumeTiming();
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_VoidVectorMallocBlobs(benchmark::State& state) {
+  std::mt19937 mt(42);
+  std::uniform_int_distribution<size_t> dist(8, 512);
+  for (auto _ : state) {
+    Vector<void*> vec;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      vec.PushBack(malloc(dist(mt)));
+    }
+    size_t sum = 0;
+    for (size_t i = 0; i < vec.Size(); ++i) {
+      sum += *static_cast<unsigned char*>(vec[i]);
+    }
+    benchmark::DoNotOptimize(sum);
+    vec.Clear();
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_VoidVectorArenaBlobs(benchmark::State& state) {
+  std::mt19937 mt(42);
+  std::uniform_int_distribution<size_t> dist(8, 512);
+  for (auto _ : state) {
+    Vector<void*> vec;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      vec.Allocate(dist(mt));
+    }
+    size_t sum = 0;
+    for (size_t i = 0; i < vec.Size(); ++i) {
+      sum += *static_cast<unsigned char*>(vec[i]);
+    }
+    benchmark::DoNotOptimize(sum);
+    vec.Clear();
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+const int64_t PARALLEL_SIZE = 100000000;
+
+void BM_ParallelReduce(benchmark::State& state) {
+  ThreadPool pool(state.range(0));
+  Vector<int64_t> vec;
+  vec.Resize(PARALLEL_SIZE, 1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ParallelReduce(vec, int64_t(0), std::plus<>(), pool));
+  }
+  state.SetBytesProcessed(state.iterations() * PARALLEL_SIZE * sizeof(int64_t));
+}
+
+void BM_ParallelTransform(benchmark::State& state) {
+  ThreadPool pool(state.range(0));
+  Vector<float> src;
+  src.Resize(PARALLEL_SIZE, 1.5f);
+  Vector<float> dst;
+  for (auto _ : state) {
+    ParallelTransform(src, dst, [](float value) { return value * value + 1.0f; }, pool);
+  }
+  state.SetBytesProcessed(state.iterations() * PARALLEL_SIZE * sizeof(float) * 2);
+}
+
+void BM_ParallelSort(benchmark::State& state) {
+  ThreadPool pool(state.range(0));
+  Vector<int> vec;
+  for (auto _ : state) {
+    state.PauseTiming();
+    vec.Clear();
+    ConstructRandomVector(vec, PARALLEL_SIZE / 10);
+    state.ResumeTiming();
+    ParallelSort(vec, std::less<>(), pool);
+  }
+}
+
+template <typename T>
+void FillSequence(Vector<T>& vec, std::vector<T>& std_vec, int64_t size) {
+  for (int64_t i = 0; i < size; ++i) {
+    vec.PushBack(static_cast<T>(i % 1000));
+    std_vec.push_back(static_cast<T>(i % 1000));
+  }
+}
+
+template <typename T>
+void FillRandom(Vector<T>& vec, size_t size) {
+  std::mt19937_64 mt(11);
+  vec.Clear();
+  for (size_t i = 0; i < size; ++i) {
+    vec.PushBack(static_cast<T>(mt()));
+  }
+}
+
+template <typename T>
+void BM_RadixSort(benchmark::State& state) {
+  Vector<T> vec;
+  for (auto _ : state) {
+    state.PauseTiming();
+    FillRandom(vec, state.range(0));
+    state.ResumeTiming();
+    RadixSort(vec);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+void BM_ParallelRadixSort(benchmark::State& state) {
+  Vector<T> vec;
+  for (auto _ : state) {
+    state.PauseTiming();
+    FillRandom(vec, state.range(0));
+    state.ResumeTiming();
+    ParallelRadixSort(vec);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+void BM_StdSortNumbers(benchmark::State& state) {
+  Vector<T> vec;
+  for (auto _ : state) {
+    state.PauseTiming();
+    FillRandom(vec, state.range(0));
+    state.ResumeTiming();
+    std::sort(vec.Data(), vec.Data() + vec.Size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_CustomVectorCopy(benchmark::State& state) {
+  Vector<int64_t> vec(state.range(0), 1);
+  for (auto _ : state) {
+    Vector<int64_t> copy = vec;
+    benchmark::DoNotOptimize(copy.Data());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_CowVectorSnapshot(benchmark::State& state) {
+  CowVector<int64_t> vec(state.range(0), 1);
+  for (auto _ : state) {
+    CowVector<int64_t> snapshot = vec;
+    benchmark::DoNotOptimize(snapshot.Data());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void FillTimestamps(CompressedVector& compressed, Vector<uint64_t>& plain, size_t size) {
+  std::mt19937_64 mt(17);
+  uint64_t timestamp = 1700000000000ULL;
+  for (size_t i = 0; i < size; ++i) {
+    timestamp += mt() % 4096;
+    compressed.PushBack(timestamp);
+    plain.PushBack(timestamp);
+  }
+}
+
+void BM_CompressedVectorScan(benchmark::State& state) {
+  CompressedVector compressed;
+  Vector<uint64_t> plain;
+  FillTimestamps(compressed, plain, state.range(0));
+  for (auto _ : state) {
+    uint64_t total = 0;
+    compressed.ForEach([&total](uint64_t value) { total += value; });
+    benchmark::DoNotOptimize(total);
+  }
+  state.counters["bytes_per_value"] = static_cast<double>(compressed.CompressedBytes()) / state.range(0);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_PlainVectorScan(benchmark::State& state) {
+  CompressedVector compressed;
+  Vector<uint64_t> plain;
+  FillTimestamps(compressed, plain, state.range(0));
+  for (auto _ : state) {
+    uint64_t total = 0;
+    for (size_t i = 0; i < plain.Size(); ++i) {
+      total += plain.Data()[i];
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_CompressedVectorRandomAccess(benchmark::State& state) {
+  CompressedVector compressed;
+  Vector<uint64_t> plain;
+  FillTimestamps(compressed, plain, state.range(0));
+  std::mt19937 mt(3);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(compressed[mt() % compressed.Size()]);
+  }
+}
+
+const int64_t PRODUCER_RECORDS = 1 << 16;
+
+ConcurrentVector<int64_t>* concurrent_log = nullptr;
+
+void BM_ConcurrentVectorProducers(benchmark::State& state) {
+  if (state.thread_index() == 0) {
+    concurrent_log = new ConcurrentVector<int64_t>();
+  }
+  for (auto _ : state) {
+    for (int64_t i = 0; i < PRODUCER_RECORDS; ++i) {
+      concurrent_log->PushBack(i);
+    }
+  }
+  if (state.thread_index() == 0) {
+    delete concurrent_log;
+  }
+  state.SetItemsProcessed(state.iterations() * PRODUCER_RECORDS);
+}
+
+Vector<int64_t>* locked_log = nullptr;
+std::mutex locked_log_mutex;
+
+void BM_MutexVectorProducers(benchmark::State& state) {
+  if (state.thread_index() == 0) {
+    locked_log = new Vector<int64_t>();
+  }
+  for (auto _ : state) {
+    for (int64_t i = 0; i < PRODUCER_RECORDS; ++i) {
+      std::lock_guard<std::mutex> lock(locked_log_mutex);
+      locked_log->PushBack(i);
+    }
+  }
+  if (state.thread_index() == 0) {
+    delete locked_log;
+  }
+  state.SetItemsProcessed(state.iterations() * PRODUCER_RECORDS);
+}
+
+// Times every push and reports latency percentiles, which is where whole-buffer copies show up.
+template <class Container>
+void BM_PushBackLatency(benchmark::State& state) {
+  std::vector<int64_t> latencies(state.range(0));
+  for (auto _ : state) {
+    Container vec;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      auto start = std::chrono::steady_clock::now();
+      vec.PushBack(i);
+      latencies[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+  }
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&latencies](double p) { return static_cast<double>(latencies[static_cast<size_t>(p * (latencies.size() - 1))]); };
+  state.counters["p50_ns"] = percentile(0.5);
+  state.counters["p99_ns"] = percentile(0.99);
+  state.counters["p999_ns"] = percentile(0.999);
+  state.counters["max_ns"] = static_cast<double>(latencies.back());
+}
+
+std::string RandomWord(std::mt19937& mt) {
+  std::string word(4 + mt() % 28, 'a');
+  for (char& c : word) {
+    c = static_cast<char>('a' + mt() % 26);
+  }
+  return word;
+}
+
+void BM_StringVectorBuildScan(benchmark::State& state) {
+  std::mt19937 mt(19);
+  std::vector<std::string> words;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    words.push_back(RandomWord(mt));
+  }
+  for (auto _ : state) {
+    StringVector<> vec;
+    vec.Append(words.begin(), words.end());
+    size_t matches = 0;
+    for (size_t i = 0; i < vec.Size(); ++i) {
+      matches += vec[i].front() == 'q';
+    }
+    benchmark::DoNotOptimize(matches);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_VectorOfStringsBuildScan(benchmark::State& state) {
+  std::mt19937 mt(19);
+  std::vector<std::string> words;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    words.push_back(RandomWord(mt));
+  }
+  for (auto _ : state) {
+    Vector<std::string> vec;
+    vec.Append(words.begin(), words.end());
+    size_t matches = 0;
+    for (size_t i = 0; i < vec.Size(); ++i) {
+      matches += vec[i].front() == 'q';
+    }
+    benchmark::DoNotOptimize(matches);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_PackedBoolCount(benchmark::State& state) {
+  BitVector bits(state.range(0), false);
+  for (int64_t i = 0; i < state.range(0); i += 3) {
+    bits.Set(i);
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(bits.Count());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_StdVectorBoolCount(benchmark::State& state) {
+  std::vector<bool> bits(state.range(0), false);
+  for (int64_t i = 0; i < state.range(0); i += 3) {
+    bits[i] = true;
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::count(bits.begin(), bits.end(), true));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_PackedBoolAnd(benchmark::State& state) {
+  BitVector a(state.range(0), true);
+  BitVector b(state.range(0), false);
+  for (auto _ : state) {
+    a.And(b);
+    benchmark::DoNotOptimize(a.Data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+struct Particle {
+  double x;
+  double y;
+  double z;
+  float mass;
+  int32_t id;
+};
+
+void BM_AoSFieldScan(benchmark::State& state) {
+  Vector<Particle> vec;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    vec.PushBack({1.0, 2.0, 3.0, 1.5f, static_cast<int32_t>(i)});
+  }
+  for (auto _ : state) {
+    float total = 0;
+    for (size_t i = 0; i < vec.Size(); ++i) {
+      total += vec.Data()[i].mass;
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(float));
+}
+
+void BM_SoAFieldScan(benchmark::State& state) {
+  SoAVector<double, double, double, float, int32_t> vec;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    vec.PushBack(1.0, 2.0, 3.0, 1.5f, static_cast<int32_t>(i));
+  }
+  for (auto _ : state) {
+    float total = 0;
+    const float* mass = vec.Data<3>();
+    for (size_t i = 0; i < vec.Size(); ++i) {
+      total += mass[i];
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(float));
+}
+
+void BM_SoAFieldSimdSum(benchmark::State& state) {
+  SoAVector<double, double, double, float, int32_t> vec;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    vec.PushBack(1.0, 2.0, 3.0, 1.5f, static_cast<int32_t>(i));
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(SimdSum(vec.Column<3>()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(float));
+}
+
+template <typename T>
+void BM_SimdFind(benchmark::State& state) {
+  Vector<T> vec;
+  std::vector<T> std_vec;
+  FillSequence(vec, std_vec, state.range(0));
+  vec.PushBack(T(-1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(SimdFind(vec, T(-1)));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template <typename T>
+void BM_StdFind(benchmark::State& state) {
+  Vector<T> vec;
+  std::vector<T> std_vec;
+  FillSequence(vec, std_vec, state.range(0));
+  std_vec.push_back(T(-1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::find(std_vec.begin(), std_vec.end(), T(-1)));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template <typename T>
+void BM_SimdCount(benchmark::State& state) {
+  Vector<T> vec;
+  std::vector<T> std_vec;
+  FillSequence(vec, std_vec, state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(SimdCount(vec, T(7)));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template <typename T>
+void BM_StdCount(benchmark::State& state) {
+  Vector<T> vec;
+  std::vector<T> std_vec;
+  FillSequence(vec, std_vec, state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::count(std_vec.begin(), std_vec.end(), T(7)));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template <typename T>
+void BM_SimdSum(benchmark::State& state) {
+  Vector<T> vec;
+  std::vector<T> std_vec;
+  FillSequence(vec, std_vec, state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(SimdSum(vec));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template <typename T>
+void BM_StdAccumulate(benchmark::State& state) {
+  Vector<T> vec;
+  std::vector<T> std_vec;
+  FillSequence(vec, std_vec, state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::accumulate(std_vec.begin(), std_vec.end(), T{}));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template <typename T>
+void BM_SimdMinMax(benchmark::State& state) {
+  Vector<T> vec;
+  std::vector<T> std_vec;
+  FillSequence(vec, std_vec, state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(SimdMinMax(vec));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template <typename T>
+void BM_StdMinMax(benchmark::State& state) {
+  Vector<T> vec;
+  std::vector<T> std_vec;
+  FillSequence(vec, std_vec, state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::minmax_element(std_vec.begin(), std_vec.end()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template <typename Bounds>
+void BM_IndexedSum(benchmark::State& state) {
+  Vector<int, std::allocator<int>, DoublingGrowth, Bounds> vec;
+  vec.Resize(state.range(0), 1);
+  for (auto _ : state) {
+    int sum = 0;
+    for (size_t i = 0; i < vec.Size(); ++i) {
+      sum += vec[i];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(int));
+}
+
+void BM_CustomVectorScatteredErase(benchmark::State& state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    Vector<int> vec;
+    ConstructRandomVector(vec, state.range(0));
+    state.ResumeTiming();
+    for (size_t i = vec.Size(); i > 0; --i) {
+      if (vec[i - 1] % 3 == 0) {
+        vec.Erase(i - 1, i);
+      }
+    }
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_CustomVectorEraseIf(benchmark::State& state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    Vector<int> vec;
+    ConstructRandomVector(vec, state.range(0));
+    state.ResumeTiming();
+    vec.EraseIf([](int value) { return value % 3 == 0; });
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_StdVectorEraseRemoveIf(benchmark::State& state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::vector<int> vec;
+    ConstructRandomVector(vec, state.range(0));
+    state.ResumeTiming();
+    vec.erase(std::remove_if(vec.begin(), vec.end(), [](int value) { return value % 3 == 0; }), vec.end());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_CustomVectorSwapErase(benchmark::State& state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    Vector<int> vec;
+    ConstructRandomVector(vec, state.range(0));
+    state.ResumeTiming();
+    while (!vec.IsEmpty()) {
+      vec.SwapErase(vec.Size() / 2);
+    }
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_CustomVectorResizeFill(benchmark::State& state) {
+  for (auto _ : state) {
+    Vector<char> vec;
+    vec.Resize(state.range(0), 0);
+    benchmark::DoNotOptimize(vec.Data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+template <class Alloc>
+void BM_CustomVectorResizeZeroed(benchmark::State& state) {
+  for (auto _ : state) {
+    Vector<char, Alloc> vec;
+    vec.ResizeZeroed(state.range(0));
+    benchmark::DoNotOptimize(vec.Data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void BM_CustomVectorResizeUninitialized(benchmark::State& state) {
+  for (auto _ : state) {
+    Vector<char> vec;
+    vec.ResizeUninitialized(state.range(0));
+    benchmark::DoNotOptimize(vec.Data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+std::string MappedBenchPath(int64_t n) {
+  std::string path = (std::filesystem::temp_directory_path() / ("mapped_vector_bench_" + std::to_string(n) + ".bin")).string();
+  if (!std::filesystem::exists(path)) {
+    MappedVector<int64_t> vec(path);
+    for (int64_t i = 0; i < n; ++i) {
+      vec.PushBack(i);
+    }
+  }
+  return path;
+}
+
+void BM_MappedVectorOpen(benchmark::State& state) {
+  std::string path = MappedBenchPath(state.range(0));
+  for (auto _ : state) {
+    MappedVector<int64_t> vec(path, MappedAccess::SEQUENTIAL);
+    benchmark::DoNotOptimize(vec.Data());
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+void BM_CustomVectorLoadFromFile(benchmark::State& state) {
+  std::string path = MappedBenchPath(state.range(0));
+  for (auto _ : state) {
+    MappedVector<int64_t> mapped(path);
+    Vector<int64_t> vec;
+    vec.Append(mapped.Data(), mapped.Size());
+    benchmark::DoNotOptimize(vec.Data());
+  }
+  state.SetComplexityN(state.range(0));
+}
 
 BENCHMARK(BM_CustomVectorPushBack)->Range(1<<10, 1<<20)->Complexity()->Unit(benchmark::kMillisecond);
 BENCHMARK(BM_StdVectorPushBack)->Range(1<<10, 1<<20)->Complexity()->Unit(benchmark::kMillisecond);
 BENCHMARK(BM_CustomVectorMiddleInsert)->Range(1<<10, 1<<15)->Complexity()->Unit(benchmark::kMillisecond);
 BENCHMARK(BM_StdVectorMiddleInsert)->Range(1<<10, 1<<15)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CustomVectorFreshEmplaceBack)->Range(1<<10, 1<<24)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CustomVectorFreshPushBack)->Range(1<<10, 1<<24)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_StdVectorFreshEmplaceBack)->Range(1<<10, 1<<24)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_StdVectorFreshPushBack)->Range(1<<10, 1<<24)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CustomVectorBatchPushBack)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CustomVectorBatchAppend)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_StdVectorBatchInsert)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_VectorDoublingReserve, Vector<int>)->RangeMultiplier(4)->Range(1<<20, 1<<28)->Iterations(10)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_VectorDoublingReserve, Vector<int, HugePageAllocator<int>>)->RangeMultiplier(4)->Range(1<<20, 1<<28)->Iterations(10)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_CustomVectorReserveRelocation, int)->RangeMultiplier(4)->Range(1<<20, 1<<29)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_CustomVectorReserveRelocation, ElementwiseInt)->RangeMultiplier(4)->Range(1<<20, 1<<29)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_CustomVectorFrontInsertErase, int)->RangeMultiplier(4)->Range(1<<20, 1<<28)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_CustomVectorFrontInsertErase, ElementwiseInt)->RangeMultiplier(4)->Range(1<<20, 1<<28)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_VoidVectorMallocBlobs)->Range(1<<10, 1<<20)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_VoidVectorArenaBlobs)->Range(1<<10, 1<<20)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ParallelReduce)->DenseRange(1, std::thread::hardware_concurrency())->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ParallelTransform)->DenseRange(1, std::thread::hardware_concurrency())->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ParallelSort)->DenseRange(1, std::thread::hardware_concurrency())->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_RadixSort, uint32_t)->Range(1<<10, 1<<25)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_RadixSort, uint64_t)->Range(1<<10, 1<<25)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ParallelRadixSort, uint32_t)->Range(1<<10, 1<<25)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ParallelRadixSort, uint64_t)->Range(1<<10, 1<<25)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_StdSortNumbers, uint32_t)->Range(1<<10, 1<<25)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_StdSortNumbers, uint64_t)->Range(1<<10, 1<<25)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CustomVectorCopy)->Range(1<<10, 1<<27)->Complexity()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CowVectorSnapshot)->Range(1<<10, 1<<27)->Complexity()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CompressedVectorScan)->Range(1<<12, 1<<26)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_PlainVectorScan)->Range(1<<12, 1<<26)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CompressedVectorRandomAccess)->Range(1<<12, 1<<26);
+BENCHMARK(BM_ConcurrentVectorProducers)->DenseThreadRange(1, std::thread::hardware_concurrency())->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MutexVectorProducers)->DenseThreadRange(1, std::thread::hardware_concurrency())->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_PushBackLatency, Vector<int64_t>)->Range(1<<16, 1<<26)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_PushBackLatency, IncrementalVector<int64_t>)->Range(1<<16, 1<<26)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_StringVectorBuildScan)->Range(1<<10, 1<<22)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_VectorOfStringsBuildScan)->Range(1<<10, 1<<22)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PackedBoolCount)->Range(1<<10, 1<<30)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_StdVectorBoolCount)->Range(1<<10, 1<<30)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_PackedBoolAnd)->Range(1<<10, 1<<30)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_AoSFieldScan)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SoAFieldScan)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SoAFieldSimdSum)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SimdFind, int)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SimdFind, float)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SimdFind, double)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_StdFind, int)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_StdFind, float)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_StdFind, double)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SimdCount, int)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SimdCount, float)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SimdCount, double)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_StdCount, int)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_StdCount, float)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_StdCount, double)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SimdSum, int)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SimdSum, float)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SimdSum, double)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_StdAccumulate, int)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_StdAccumulate, float)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_StdAccumulate, double)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SimdMinMax, int)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SimdMinMax, float)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SimdMinMax, double)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_StdMinMax, int)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_StdMinMax, float)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_StdMinMax, double)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_IndexedSum, CheckedBounds)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_IndexedSum, AssertBounds)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_IndexedSum, UncheckedBounds)->Range(1<<10, 1<<24)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CustomVectorScatteredErase)->Range(1<<10, 1<<16)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CustomVectorEraseIf)->Range(1<<10, 1<<22)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_StdVectorEraseRemoveIf)->Range(1<<10, 1<<22)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CustomVectorSwapErase)->Range(1<<10, 1<<22)->Complexity()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CustomVectorResizeFill)->Range(1<<12, 1<<28)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_CustomVectorResizeZeroed, std::allocator<char>)->Range(1<<12, 1<<28)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_CustomVectorResizeZeroed, HugePageAllocator<char>)->Range(1<<12, 1<<28)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CustomVectorResizeUninitialized)->Range(1<<12, 1<<28)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_MappedVectorOpen)->Range(1<<10, 1<<24)->Complexity()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CustomVectorLoadFromFile)->Range(1<<10, 1<<24)->Complexity()->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SmallSizeFill, Vector<int, CountingAllocator<int>>)->DenseRange(0, 32, 4);
+BENCHMARK_TEMPLATE(BM_SmallSizeFill, SmallVector<int, 16, CountingAllocator<int>>)->DenseRange(0, 32, 4);
+BENCHMARK_TEMPLATE(BM_SmallSizeFill, StaticVector<int, 32>)->DenseRange(0, 32, 4);
 
 BENCHMARK_MAIN();
\ No newline at end of file
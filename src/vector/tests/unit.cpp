@@ -1,16 +1,35 @@
 #include "../vector.hpp"
 #include "../vector.cpp"
+#include "../bit_vector.hpp"
+#include "../compressed_vector.hpp"
+#include "../concurrent_vector.hpp"
+#include "../cow_vector.hpp"
+#include "../huge_page_allocator.hpp"
+#include "../incremental_vector.hpp"
+#include "../mapped_vector.hpp"
+#include "../parallel.hpp"
+#include "../radix_sort.hpp"
+#include "../simd.hpp"
+#include "../small_vector.hpp"
+#include "../soa_vector.hpp"
+#include "../static_vector.hpp"
+#include "../string_vector.hpp"
 
 #include <fmt/core.h>
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <filesystem>
 #include <future>
 #include <iostream>
+#include <list>
+#include <sstream>
 #include <string>
 #include <thread>
 #include <vector>
 #include <memory>
+#include <numeric>
+#include <random>
 
 class Singleton {
 private:
@@ -88,6 +107,37 @@ struct President {
     President& operator=(const President& other) = default;
 };
 
+struct Handle {
+    explicit Handle(int value) : ptr(std::make_unique<int>(value)) {
+    }
+
+    std::unique_ptr<int> ptr;
+};
+
+template <>
+struct IsTriviallyRelocatable<Handle> : std::true_type {};
+
+// Refuses to be built from 13 and counts live instances.
+struct ThrowingValue {
+    ThrowingValue(int v) : value(std::to_string(v)) {
+        if (v == 13) {
+            throw std::invalid_argument("unlucky");
+        }
+        ++live;
+    }
+
+    ThrowingValue(ThrowingValue&& other) noexcept : value(std::move(other.value)) {
+        ++live;
+    }
+
+    ~ThrowingValue() {
+        --live;
+    }
+
+    std::string value;
+    static inline int live = 0;
+};
+
 class VectorTest : public testing::Test {
 protected:
     void SetUp() override {
@@ -253,6 +303,1077 @@ TEST(EmptyVectorTest, VoidAsTemplate) {
 }
 
 
+TEST(EmptyVectorTest, RelocatableReserve) {
+    Vector<Handle> vec;
+    for (int i = 0; i < 100; ++i) {
+        vec.EmplaceBack(i);
+    }
+    vec.Reserve(1000);
+    ASSERT_EQ(vec.Size(), 100);
+    for (size_t i = 0; i < vec.Size(); ++i) {
+        ASSERT_EQ(*vec[i].ptr, i);
+    }
+}
+
+TEST(EmptyVectorTest, RelocatableInsertErase) {
+    Vector<Handle> vec;
+    for (int i = 0; i < 10; ++i) {
+        vec.EmplaceBack(i);
+    }
+    vec.Insert(5, Handle(100));
+    ASSERT_EQ(*vec[5].ptr, 100);
+    ASSERT_EQ(*vec[6].ptr, 5);
+    vec.Erase(2, 6);
+    std::vector<int> expected = {0, 1, 5, 6, 7, 8, 9};
+    ASSERT_EQ(vec.Size(), expected.size());
+    for (size_t i = 0; i < vec.Size(); ++i) {
+        ASSERT_EQ(*vec[i].ptr, expected[i]); // leaks or double frees are caught by ASAN
+    }
+}
+
+TEST(EmptyVectorTest, EmplaceBackGrowsGeometrically) {
+    Vector<int> vec;
+    size_t reallocations = 0;
+    size_t cap = vec.Capacity();
+    for (int i = 0; i < 1 << 16; ++i) {
+        vec.EmplaceBack(i);
+        if (vec.Capacity() != cap) {
+            cap = vec.Capacity();
+            ++reallocations;
+        }
+    }
+    ASSERT_LT(reallocations, 20) << "EmplaceBack must not reallocate on every call!";
+}
+
+TEST(EmptyVectorTest, GrowthPolicies) {
+    Vector<int, std::allocator<int>, OneAndHalfGrowth> one_and_half;
+    Vector<int, std::allocator<int>, FixedStepGrowth<100>> fixed_step;
+    Vector<int, std::allocator<int>, SizeClassGrowth> size_class;
+    for (int i = 0; i < 1000; ++i) {
+        one_and_half.PushBack(i);
+        fixed_step.EmplaceBack(i);
+        size_class.PushBack(i);
+    }
+    ASSERT_EQ(one_and_half.Capacity(), 1234);
+    ASSERT_EQ(fixed_step.Capacity(), 1000);
+    ASSERT_EQ(size_class.Capacity(), 1024);
+    for (size_t i = 0; i < 1000; ++i) {
+        ASSERT_EQ(one_and_half[i], i);
+        ASSERT_EQ(fixed_step[i], i);
+        ASSERT_EQ(size_class[i], i);
+    }
+}
+
+TEST(EmptyVectorTest, PushBackAfterClear) {
+    Vector<int> vec({1, 2, 3});
+    vec.Clear();
+    vec.PushBack(4);
+    ASSERT_EQ(vec.Size(), 1);
+    ASSERT_EQ(vec[0], 4);
+}
+
+TEST(SmallVectorTest, StaysInline) {
+    SmallVector<int, 4> vec;
+    ASSERT_TRUE(vec.IsInline());
+    ASSERT_EQ(vec.Capacity(), 4);
+    for (int i = 0; i < 4; ++i) {
+        vec.PushBack(i);
+    }
+    ASSERT_TRUE(vec.IsInline());
+    vec.PushBack(4);
+    ASSERT_FALSE(vec.IsInline()) << "SmallVector must spill to the heap beyond N!";
+    for (size_t i = 0; i < vec.Size(); ++i) {
+        ASSERT_EQ(vec[i], i);
+    }
+}
+
+TEST(SmallVectorTest, InsertEraseStrings) {
+    SmallVector<std::string, 2> vec({"b", "d"});
+    vec.Insert(0, "a");
+    vec.Insert(2, "c");
+    vec.EmplaceBack(3, 'e');
+    std::vector<std::string> expected = {"a", "b", "c", "d", "eee"};
+    ASSERT_EQ(vec.Size(), expected.size());
+    for (size_t i = 0; i < vec.Size(); ++i) {
+        ASSERT_EQ(vec[i], expected[i]);
+    }
+    vec.Erase(1, 3);
+    ASSERT_EQ(vec.Size(), 3);
+    ASSERT_EQ(vec[1], "d");
+    vec.Resize(1, "");
+    ASSERT_EQ(vec.Size(), 1);
+    ASSERT_EQ(vec.Back(), "a");
+}
+
+TEST(SmallVectorTest, InsertPastEndThrows) {
+    SmallVector<int, 2> small({1, 2});
+    Vector<int> vec({1, 2});
+    ASSERT_THROW(small.Insert(3, 0), std::out_of_range);
+    ASSERT_THROW(vec.Insert(3, 0), std::out_of_range);
+    small.Insert(2, 3);
+    vec.Insert(2, 3);
+    ASSERT_EQ(small.Back(), 3);
+    ASSERT_EQ(vec.Back(), 3);
+}
+
+TEST(SmallVectorTest, MoveInlineAndHeap) {
+    SmallVector<std::unique_ptr<int>, 2> small;
+    small.PushBack(std::make_unique<int>(1));
+    SmallVector<std::unique_ptr<int>, 2> moved_small = std::move(small);
+    ASSERT_EQ(small.Size(), 0);
+    ASSERT_EQ(*moved_small[0], 1);
+
+    SmallVector<std::unique_ptr<int>, 2> big;
+    for (int i = 0; i < 10; ++i) {
+        big.PushBack(std::make_unique<int>(i));
+    }
+    int* raw = big.Data()->get();
+    SmallVector<std::unique_ptr<int>, 2> moved_big;
+    moved_big = std::move(big);
+    ASSERT_TRUE(big.IsInline());
+    ASSERT_EQ(moved_big.Size(), 10);
+    ASSERT_EQ(moved_big[0].get(), raw) << "Heap buffer must be stolen, not copied!";
+}
+
+TEST(SmallVectorTest, Copy) {
+    SmallVector<int, 3> vec({1, 2, 3, 4, 5});
+    SmallVector<int, 3> copy = vec;
+    ASSERT_EQ(copy.Size(), vec.Size());
+    for (size_t i = 0; i < vec.Size(); ++i) {
+        ASSERT_EQ(copy[i], vec[i]);
+    }
+}
+
+constexpr StaticVector<int, 16> Squares() {
+    StaticVector<int, 16> table;
+    for (int i = 0; i < 10; ++i) {
+        table.PushBack(i * i);
+    }
+    table.SwapErase(0);
+    table.Insert(0, -1);
+    table.Erase(1, 3);
+    return table;
+}
+
+TEST(StaticVectorTest, ConstexprTable) {
+    constexpr auto table = Squares();
+    static_assert(table.Size() == 8);
+    static_assert(table[0] == -1 && table[1] == 4 && table.Back() == 64);
+    static_assert(std::is_trivially_copyable_v<StaticVector<int, 16>>);
+    static_assert(!std::is_trivially_copyable_v<StaticVector<std::string, 4>>);
+
+    StaticVector<int, 16> copy;
+    std::memcpy(static_cast<void*>(&copy), &table, sizeof(table));
+    ASSERT_EQ(copy.Size(), 8);
+    ASSERT_EQ(copy[2], 9);
+}
+
+TEST(StaticVectorTest, CapacityBound) {
+    StaticVector<std::string, 3> vec = {"a", "b"};
+    vec.EmplaceBack(2, 'c');
+    ASSERT_TRUE(vec.IsFull());
+    ASSERT_EQ(vec.Back(), "cc");
+    ASSERT_THROW(vec.PushBack("d"), std::length_error);
+    ASSERT_THROW(vec[3], std::out_of_range);
+    vec.Erase(0, 1);
+    ASSERT_EQ(vec.Front(), "b");
+    vec.Resize(1, "");
+    ASSERT_EQ(vec.Size(), 1);
+    vec.Clear();
+    ASSERT_TRUE(vec.IsEmpty());
+}
+
+TEST(CowVectorTest, CopiesShareUntilWrite) {
+    CowVector<std::string> vec = {"a", "b", "c"};
+    CowVector<std::string> snapshot = vec;
+    ASSERT_EQ(vec.UseCount(), 2);
+    ASSERT_EQ(snapshot.Data(), vec.Data());
+
+    vec.PushBack("d");
+    ASSERT_FALSE(vec.IsShared());
+    ASSERT_FALSE(snapshot.IsShared());
+    ASSERT_EQ(vec.Size(), 4);
+    ASSERT_EQ(snapshot.Size(), 3);
+
+    CowVector<std::string> other = snapshot;
+    other.Mutable(0) = "z";
+    ASSERT_EQ(other[0], "z");
+    ASSERT_EQ(snapshot[0], "a");
+    snapshot = other;
+    ASSERT_EQ(snapshot.UseCount(), 2);
+    snapshot.Clear();
+    ASSERT_TRUE(snapshot.IsEmpty());
+    ASSERT_EQ(other.Size(), 3);
+}
+
+TEST(CowVectorTest, MoveStealsBuffer) {
+    static_assert(std::is_nothrow_move_constructible_v<CowVector<std::string>>);
+    CowVector<std::string> vec = {"a", "b"};
+    const std::string* data = vec.Data();
+    CowVector<std::string> moved(std::move(vec));
+    ASSERT_EQ(moved.Data(), data);
+    ASSERT_EQ(moved.UseCount(), 1);
+    ASSERT_TRUE(vec.IsEmpty());
+    ASSERT_EQ(vec.UseCount(), 0);
+    ASSERT_THROW(vec[0], std::out_of_range);
+    ASSERT_THROW(vec.Front(), std::out_of_range);
+    ASSERT_THROW(vec.Back(), std::out_of_range);
+    CowVector<std::string> copy = vec;
+    vec.PushBack("c");
+    ASSERT_EQ(vec[0], "c");
+    ASSERT_EQ(vec.Front(), vec.Back());
+    ASSERT_TRUE(copy.IsEmpty());
+    std::vector<CowVector<std::string>> many(4, moved);
+    many.resize(64);
+    ASSERT_EQ(moved.UseCount(), 5) << "Reallocation must move, not copy, CowVectors!";
+}
+
+TEST(CowVectorTest, SnapshotsAcrossThreads) {
+    CowVector<int> vec(1000, 1);
+    std::vector<std::thread> readers;
+    std::atomic<int> total = 0;
+    for (int i = 0; i < 8; ++i) {
+        readers.emplace_back([snapshot = vec, &total]() mutable {
+            CowVector<int> local = snapshot;
+            total += std::accumulate(local.Data(), local.Data() + local.Size(), 0);
+            local.Mutable(0) = 2;
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    ASSERT_EQ(total, 8000);
+    ASSERT_EQ(vec.UseCount(), 1);
+    ASSERT_EQ(vec[0], 1);
+}
+
+TEST(CompressedVectorTest, RoundTrip) {
+    std::mt19937_64 mt(13);
+    CompressedVector vec;
+    std::vector<uint64_t> expected;
+    uint64_t timestamp = 1700000000000ULL;
+    for (int i = 0; i < 10000; ++i) {
+        timestamp += mt() % 1000;
+        uint64_t value = (i / 1000 == 7) ? mt() : timestamp;
+        vec.PushBack(value);
+        expected.push_back(value);
+    }
+    for (int i = 0; i < 300; ++i) {
+        vec.PushBack(42);
+        expected.push_back(42);
+    }
+    ASSERT_EQ(vec.Size(), expected.size());
+    ASSERT_LT(vec.CompressedBytes(), expected.size() * sizeof(uint64_t) / 2);
+    for (size_t i = 0; i < expected.size(); i += 7) {
+        ASSERT_EQ(vec[i], expected[i]);
+    }
+    for (SimdLevel level : {SimdLevel::SCALAR, DetectSimdLevel()}) {
+        Vector<uint64_t> decoded;
+        vec.Decode(decoded, level);
+        ASSERT_EQ(decoded.Size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            ASSERT_EQ(decoded[i], expected[i]);
+        }
+    }
+    size_t index = 0;
+    vec.ForEach([&](uint64_t value) { ASSERT_EQ(value, expected[index++]); });
+    ASSERT_EQ(index, expected.size());
+    ASSERT_THROW(vec[expected.size()], std::out_of_range);
+}
+
+TEST(ConcurrentVectorTest, ParallelProducers) {
+    ConcurrentVector<std::pair<int, int>> vec;
+    const int producers = 8;
+    const int per_producer = 20000;
+    std::atomic<bool> done = false;
+    std::thread reader([&] {
+        while (!done) {
+            size_t size = vec.Size();
+            if (size > 0) {
+                ASSERT_LT(vec[size - 1].first, producers);
+            }
+        }
+    });
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&vec, p] {
+            for (int i = 0; i < per_producer; ++i) {
+                vec.EmplaceBack(p, i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    done = true;
+    reader.join();
+
+    ASSERT_EQ(vec.Size(), producers * per_producer);
+    std::vector<int> last(producers, -1);
+    for (size_t i = 0; i < vec.Size(); ++i) {
+        auto [p, value] = vec[i];
+        ASSERT_GT(value, last[p]) << "Values of one producer must keep their order!";
+        last[p] = value;
+    }
+}
+
+TEST(ConcurrentVectorTest, StableReferences) {
+    ConcurrentVector<std::string> vec;
+    vec.PushBack("first");
+    const std::string* first = &vec[0];
+    for (int i = 0; i < 100000; ++i) {
+        vec.PushBack(std::to_string(i));
+    }
+    ASSERT_EQ(first, &vec[0]);
+    ASSERT_EQ(vec[100000], "99999");
+    ASSERT_THROW(vec[100001], std::out_of_range);
+}
+
+TEST(ConcurrentVectorTest, ThrowingConstructorLeavesHole) {
+    struct Checked {
+        explicit Checked(int v) : value(std::to_string(v)) {
+            if (v % 100 == 7) {
+                throw std::invalid_argument("rejected");
+            }
+        }
+        std::string value;
+    };
+    ConcurrentVector<Checked> vec;
+    std::atomic<int> failures = 0;
+    std::vector<std::thread> threads;
+    for (int p = 0; p < 4; ++p) {
+        threads.emplace_back([&vec, &failures, p] {
+            for (int i = p; i < 4000; i += 4) {
+                try {
+                    vec.EmplaceBack(i);
+                } catch (const std::invalid_argument&) {
+                    ++failures;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(failures.load(), 40);
+    ASSERT_EQ(vec.Size(), 4000) << "A failed construction must not stall publication!";
+    size_t holes = 0;
+    for (size_t i = 0; i < vec.Size(); ++i) {
+        if (vec.HasValue(i)) {
+            ASSERT_NE(std::stoi(vec[i].value) % 100, 7);
+        } else {
+            ASSERT_THROW(vec[i], std::out_of_range);
+            ++holes;
+        }
+    }
+    ASSERT_EQ(holes, 40);
+}
+
+TEST(IncrementalVectorTest, IndexingDuringMigration) {
+    IncrementalVector<std::string, std::allocator<std::string>, DoublingGrowth, 2> vec;
+    bool saw_migration = false;
+    for (int i = 0; i < 5000; ++i) {
+        vec.PushBack(std::to_string(i));
+        saw_migration |= vec.IsMigrating();
+        if (i % 97 == 0) {
+            for (int j = 0; j <= i; ++j) {
+                ASSERT_EQ(vec[j], std::to_string(j));
+            }
+        }
+    }
+    ASSERT_TRUE(saw_migration);
+    while (vec.IsMigrating()) {
+        vec.PopBack();
+    }
+    size_t size = vec.Size();
+    ASSERT_EQ(vec.Back(), std::to_string(size - 1));
+    vec.PushBack("x");
+    ASSERT_EQ(vec.Data()[size], "x");
+    ASSERT_FALSE(vec.IsMigrating());
+    ASSERT_THROW(vec[size + 1], std::out_of_range);
+}
+
+TEST(IncrementalVectorTest, TrivialMigration) {
+    IncrementalVector<int64_t> vec;
+    vec.Reserve(100);
+    for (int64_t i = 0; i < 1000; ++i) {
+        vec.PushBack(i);
+    }
+    vec.FinishMigration();
+    ASSERT_FALSE(vec.IsMigrating());
+    for (int64_t i = 0; i < 1000; ++i) {
+        ASSERT_EQ(vec.Data()[i], i);
+    }
+    vec.Clear();
+    ASSERT_TRUE(vec.IsEmpty());
+}
+
+TEST(IncrementalVectorTest, FixedStepGrowthBoundsEachPush) {
+    size_t moves = 0;
+    struct Counted {
+        Counted(int v, size_t* counter) : value(v), moves(counter) {
+        }
+        Counted(Counted&& other) noexcept : value(other.value), moves(other.moves) {
+            ++*moves;
+        }
+        int value;
+        size_t* moves;
+    };
+    IncrementalVector<Counted, std::allocator<Counted>, FixedStepGrowth<16>> vec;
+    for (int i = 0; i < 5000; ++i) {
+        size_t before = moves;
+        vec.EmplaceBack(i, &moves);
+        size_t bound = std::max<size_t>(4, (vec.Size() + 15) / 16 + 1);
+        ASSERT_LE(moves - before, bound) << "Push " << i << " moved too many elements!";
+    }
+    for (int i = 0; i < 5000; ++i) {
+        ASSERT_EQ(vec[i].value, i);
+    }
+}
+
+TEST(StringVectorTest, PushBackAndAppend) {
+    StringVector<> vec;
+    vec.PushBack("alpha");
+    vec.PushBack("");
+    vec.PushBack(std::string(100, 'x'));
+    ASSERT_EQ(vec.Size(), 3);
+    ASSERT_EQ(vec[0], "alpha");
+    ASSERT_TRUE(vec[1].empty());
+    ASSERT_EQ(vec[2].size(), 100);
+    ASSERT_EQ(vec.Bytes(), 105);
+
+    std::vector<std::string> words = {"one", "two", "three"};
+    StringVector<uint64_t> other;
+    other.Append(words.begin(), words.end());
+    vec.Append(other);
+    ASSERT_EQ(vec.Size(), 6);
+    ASSERT_EQ(vec[5], "three");
+    ASSERT_EQ(vec.Back(), "three");
+
+    vec.PopBack();
+    ASSERT_EQ(vec.Back(), "two");
+    ASSERT_EQ(vec.Bytes(), 111);
+    ASSERT_THROW(vec[5], std::out_of_range);
+
+    vec.Clear();
+    ASSERT_TRUE(vec.IsEmpty());
+    ASSERT_EQ(vec.Bytes(), 0);
+    vec.PushBack("again");
+    ASSERT_EQ(vec[0], "again");
+}
+
+TEST(StringVectorTest, AppendSelf) {
+    StringVector<> vec;
+    vec.PushBack("ab");
+    vec.PushBack("");
+    vec.PushBack("cde");
+    for (int round = 0; round < 8; ++round) {
+        vec.Append(vec);
+    }
+    ASSERT_EQ(vec.Size(), 3 << 8);
+    ASSERT_EQ(vec.Bytes(), 5 << 8);
+    for (size_t i = 0; i < vec.Size(); i += 3) {
+        ASSERT_EQ(vec[i], "ab");
+        ASSERT_TRUE(vec[i + 1].empty());
+        ASSERT_EQ(vec[i + 2], "cde");
+    }
+}
+
+TEST(EmptyVectorTest, AppendRanges) {
+    Vector<int> vec;
+    int raw[] = {1, 2, 3};
+    vec.Append(raw, 3);
+    std::list<int> list = {4, 5};
+    vec.Append(list.begin(), list.end());
+    std::istringstream stream("6 7 8");
+    vec.Append(std::istream_iterator<int>(stream), std::istream_iterator<int>());
+    ASSERT_EQ(vec.Size(), 8);
+    for (size_t i = 0; i < vec.Size(); ++i) {
+        ASSERT_EQ(vec[i], i + 1);
+    }
+}
+
+TEST(EmptyVectorTest, AppendReallocatesOnce) {
+    Vector<int> vec({1});
+    std::vector<int> batch(100000, 7);
+    vec.Append(batch.data(), batch.size());
+    ASSERT_EQ(vec.Size(), batch.size() + 1);
+    ASSERT_EQ(vec.Capacity(), batch.size() + 1);
+    ASSERT_EQ(vec.Back(), 7);
+}
+
+TEST(EmptyVectorTest, AppendSelf) {
+    Vector<std::string> vec({"a", "b"});
+    vec.Append(vec.Data(), vec.Size());
+    ASSERT_EQ(vec.Size(), 4);
+    ASSERT_EQ(vec[2], "a");
+    ASSERT_EQ(vec[3], "b");
+}
+
+TEST(EmptyVectorTest, AppendFrom) {
+    Vector<std::unique_ptr<int>> vec;
+    Vector<std::unique_ptr<int>> other;
+    other.PushBack(std::make_unique<int>(1));
+    vec.AppendFrom(std::move(other));
+    ASSERT_EQ(other.Size(), 0);
+    other.PushBack(std::make_unique<int>(2));
+    vec.AppendFrom(std::move(other));
+    ASSERT_EQ(vec.Size(), 2);
+    ASSERT_EQ(*vec[0], 1);
+    ASSERT_EQ(*vec[1], 2);
+}
+
+TEST(EmptyVectorTest, InsertRangeThrowingConstructor) {
+    {
+        Vector<ThrowingValue> vec;
+        for (int i = 0; i < 5; ++i) {
+            vec.EmplaceBack(i);
+        }
+        std::vector<int> batch = {10, 11, 13, 12};
+        ASSERT_THROW(vec.InsertRange(2, batch.begin(), batch.end()), std::invalid_argument);
+        ASSERT_EQ(vec.Size(), 5);
+        for (int i = 0; i < 5; ++i) {
+            ASSERT_EQ(vec[i].value, std::to_string(i)) << "The tail must be moved back in place!";
+        }
+        ASSERT_EQ(ThrowingValue::live, 5) << "Elements built before the throw must be destroyed!";
+    }
+    ASSERT_EQ(ThrowingValue::live, 0);
+}
+
+TEST_F(VectorTest, InsertRangeMid) {
+    std::vector<int> batch = {10, 11, 12};
+    vec.InsertRange(2, batch.begin(), batch.end());
+    std::vector<int> expected = {1, 2, 10, 11, 12, 3, 4, 5, 6, 7};
+    ASSERT_EQ(vec.Size(), expected.size());
+    for (size_t i = 0; i < vec.Size(); ++i) {
+        ASSERT_EQ(vec[i], expected[i]);
+    }
+}
+
+TEST(EmptyVectorTest, HugePageAllocatorGrowth) {
+    Vector<int64_t, HugePageAllocator<int64_t>> vec;
+    for (int64_t i = 0; i < 1 << 20; ++i) {
+        vec.PushBack(i);
+    }
+    ASSERT_EQ(vec.Size(), 1 << 20);
+    for (size_t i = 0; i < vec.Size(); ++i) {
+        ASSERT_EQ(vec[i], i);
+    }
+}
+
+TEST(EmptyVectorTest, HugePageAllocatorAlignment) {
+    using Alloc = HugePageAllocator<int64_t>;
+    Alloc alloc;
+    size_t small = Alloc::MMAP_THRESHOLD / sizeof(int64_t) / 2;
+    int64_t* ptr = alloc.allocate(small);
+    for (size_t i = 0; i < 16; ++i) {
+        ptr[i] = i;
+    }
+    size_t mapped = 3 * Alloc::MMAP_THRESHOLD / sizeof(int64_t);
+    ptr = alloc.reallocate(ptr, small, mapped, 16);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % Alloc::HUGE_PAGE_SIZE, 0);
+    ptr[mapped - 1] = 1;
+    ptr = alloc.reallocate(ptr, mapped, 8 * mapped, mapped);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % Alloc::HUGE_PAGE_SIZE, 0);
+    for (size_t i = 0; i < 16; ++i) {
+        ASSERT_EQ(ptr[i], i);
+    }
+    ASSERT_EQ(ptr[mapped - 1], 1);
+    alloc.deallocate(ptr, 8 * mapped);
+}
+
+TEST(EmptyVectorTest, HugePageAllocatorNonTrivial) {
+    Vector<std::string, HugePageAllocator<std::string>> vec;
+    for (int i = 0; i < 1 << 17; ++i) {
+        vec.PushBack(std::to_string(i));
+    }
+    ASSERT_EQ(vec[12345], "12345");
+    ASSERT_EQ(vec.Back(), std::to_string((1 << 17) - 1));
+}
+
+TEST(EmptyVectorTest, VoidBlobArena) {
+    Vector<void*> vec;
+    for (size_t i = 1; i <= 1000; ++i) {
+        char* blob = static_cast<char*>(vec.Allocate(i % 300 + 1));
+        std::memset(blob, static_cast<int>(i % 256), i % 300 + 1);
+    }
+    vec.PushBack(malloc(10));
+    vec.Allocate(100000);
+    ASSERT_EQ(vec.Size(), 1002);
+    for (size_t i = 1; i <= 1000; ++i) {
+        ASSERT_EQ(static_cast<unsigned char*>(vec[i - 1])[i % 300], i % 256);
+    }
+    size_t slabs = vec.SlabCount();
+    ASSERT_GT(slabs, 0);
+    vec.Clear();
+    ASSERT_EQ(vec.Size(), 0);
+    ASSERT_EQ(vec.SlabCount(), 0);
+}
+
+TEST(EmptyVectorTest, VoidBlobRecycle) {
+    Vector<void*> vec;
+    vec.Allocate(40);
+    void* second = vec.Allocate(60);
+    void* third = malloc(1);
+    vec.PushBack(third);
+    vec.Recycle(1);
+    ASSERT_EQ(vec.Size(), 3);
+    ASSERT_EQ(vec[1], nullptr);
+    ASSERT_EQ(vec[2], third) << "Recycling must not shift later blobs!";
+    vec.Recycle(1);
+    vec.Recycle(2);
+    ASSERT_EQ(vec.Size(), 1);
+    ASSERT_EQ(vec.Allocate(50), second) << "Recycled blob must be reused by its size class!";
+    ASSERT_EQ(vec.Back(), second);
+}
+
+TEST(EmptyVectorTest, VoidBlobMoveAndFailure) {
+    static_assert(std::is_nothrow_move_constructible_v<Vector<void*>>);
+    auto make = [] {
+        Vector<void*> vec;
+        std::memset(vec.Allocate(32), 7, 32);
+        vec.Allocate(10000);
+        return vec;
+    };
+    Vector<void*> vec = make();
+    ASSERT_EQ(vec.Size(), 2);
+    ASSERT_EQ(static_cast<unsigned char*>(vec[0])[31], 7);
+    Vector<void*> other = std::move(vec);
+    ASSERT_TRUE(vec.IsEmpty());
+    ASSERT_EQ(other.Size(), 2);
+    ASSERT_THROW(other.Allocate(size_t(1) << 62), std::bad_alloc);
+    ASSERT_EQ(other.Size(), 2);
+}
+
+TEST(BitVectorTest, PushBackCountFind) {
+    BitVector bits;
+    std::vector<bool> expected;
+    std::mt19937 mt(9);
+    for (int i = 0; i < 1000; ++i) {
+        bool value = mt() % 3 == 0;
+        bits.PushBack(value);
+        expected.push_back(value);
+    }
+    ASSERT_EQ(bits.Size(), 1000);
+    ASSERT_EQ(bits.Count(), std::count(expected.begin(), expected.end(), true));
+    size_t found = 0;
+    for (size_t pos = bits.FindFirst(); pos < bits.Size(); pos = bits.FindNext(pos)) {
+        ASSERT_TRUE(expected[pos]);
+        ++found;
+    }
+    ASSERT_EQ(found, bits.Count());
+
+    bits.Resize(1030, true);
+    ASSERT_TRUE(bits[1029]);
+    bits.Resize(70);
+    bits.Resize(200);
+    ASSERT_FALSE(bits[150]);
+    bits.PopBack();
+    ASSERT_EQ(bits.Size(), 199);
+    ASSERT_THROW(bits[199], std::out_of_range);
+}
+
+TEST(BitVectorTest, WordOps) {
+    BitVector a(130, false);
+    BitVector b(130, true);
+    ASSERT_EQ(a.FindFirst(), 130);
+    a.Set(3);
+    a.Set(129);
+    b.Reset(3);
+    ASSERT_EQ(b.Count(), 129);
+    BitVector c = a;
+    c.And(b);
+    ASSERT_EQ(c.Count(), 1);
+    ASSERT_EQ(c.FindFirst(), 129);
+    c.Or(a);
+    ASSERT_EQ(c.Count(), 2);
+    c.Xor(b);
+    ASSERT_EQ(c.Count(), 129);
+    ASSERT_FALSE(c[129]);
+    ASSERT_THROW(c.And(BitVector(10, true)), std::invalid_argument);
+}
+
+TEST(BitVectorTest, EmptyCopiesAndBoolVector) {
+    BitVector empty;
+    BitVector copy = empty;
+    copy.Clear();
+    copy.Resize(0);
+    ASSERT_TRUE(copy.IsEmpty());
+
+    Vector<bool> flags({true, false});
+    flags.Insert(1, true);
+    ASSERT_EQ(flags.Size(), 3);
+    ASSERT_TRUE(flags[1]);
+    ASSERT_FALSE(*(flags.Data() + 2));
+    SoAVector<int, bool> rows;
+    rows.EmplaceBack(1, true);
+    rows.SwapErase(0);
+    ASSERT_TRUE(rows.IsEmpty());
+}
+
+TEST(ParallelTest, ForEachFillTransformReduce) {
+    ThreadPool pool(4);
+    Vector<int64_t> vec;
+    vec.Resize(1 << 18, 0);
+    ParallelFill(vec, int64_t(2), pool);
+    ParallelForEach(vec, [](int64_t& value) { value *= 3; }, pool);
+    Vector<double> halves;
+    ParallelTransform(vec, halves, [](int64_t value) { return value / 2.0; }, pool);
+    ASSERT_EQ(halves.Size(), vec.Size());
+    ASSERT_EQ(halves[12345], 3.0);
+    ASSERT_EQ(ParallelReduce(vec, int64_t(0), std::plus<>(), pool), 6 * (1 << 18));
+    ASSERT_EQ(ParallelReduce(Vector<int>(), 7), 7);
+}
+
+TEST(ParallelTest, Sort) {
+    ThreadPool pool(3);
+    Vector<int> vec;
+    std::mt19937 mt(1);
+    for (int i = 0; i < 200000; ++i) {
+        vec.PushBack(static_cast<int>(mt()));
+    }
+    ParallelSort(vec, std::less<>(), pool);
+    ASSERT_TRUE(std::is_sorted(vec.Data(), vec.Data() + vec.Size()));
+    ParallelSort(vec, std::greater<>(), pool);
+    ASSERT_TRUE(std::is_sorted(vec.Data(), vec.Data() + vec.Size(), std::greater<>()));
+}
+
+TEST(ParallelTest, TaskExceptions) {
+    ThreadPool pool(4);
+    for (size_t thrower : {size_t(0), size_t(63)}) {
+        std::atomic<size_t> ran = 0;
+        ASSERT_THROW(pool.Run(64,
+                              [&](size_t i) {
+                                  if (i == thrower) {
+                                      throw std::runtime_error("task failed");
+                                  }
+                                  ++ran;
+                              }),
+                     std::runtime_error);
+        ASSERT_LT(ran.load(), 64);
+    }
+    std::atomic<size_t> ran = 0;
+    pool.Run(64, [&](size_t) { ++ran; });
+    ASSERT_EQ(ran.load(), 64) << "The pool must stay usable after a task throws!";
+}
+
+TEST(ParallelTest, NestedRun) {
+    ThreadPool pool(4);
+    std::atomic<size_t> ran = 0;
+    pool.Run(8, [&](size_t) { pool.Run(8, [&](size_t) { ++ran; }); });
+    ASSERT_EQ(ran.load(), 64);
+}
+
+template <typename T>
+class RadixSortTest : public testing::Test {};
+
+using RadixTypes = testing::Types<uint8_t, int16_t, uint32_t, int32_t, uint64_t, int64_t, float, double>;
+TYPED_TEST_SUITE(RadixSortTest, RadixTypes);
+
+TYPED_TEST(RadixSortTest, MatchesStdSort) {
+    std::mt19937_64 mt(3);
+    Vector<TypeParam> vec;
+    std::vector<TypeParam> expected;
+    for (int i = 0; i < 100000; ++i) {
+        TypeParam value;
+        if constexpr (std::is_floating_point_v<TypeParam>) {
+            value = static_cast<TypeParam>(std::uniform_real_distribution<double>(-1e6, 1e6)(mt));
+        } else {
+            value = static_cast<TypeParam>(mt());
+        }
+        vec.PushBack(value);
+        expected.push_back(value);
+    }
+    std::sort(expected.begin(), expected.end());
+    Vector<TypeParam> parallel = vec;
+    RadixSort(vec);
+    ThreadPool pool(3);
+    ParallelRadixSort(parallel, IdentityKey(), pool);
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(vec[i], expected[i]);
+        ASSERT_EQ(parallel[i], expected[i]);
+    }
+}
+
+TEST(RadixSortTest, RecordsByKeyAreStable) {
+    struct Record {
+        int32_t key;
+        uint32_t order;
+    };
+    Vector<Record> vec;
+    std::mt19937 mt(5);
+    for (uint32_t i = 0; i < 50000; ++i) {
+        vec.PushBack({static_cast<int32_t>(mt() % 1000) - 500, i});
+    }
+    ThreadPool pool(4);
+    ParallelRadixSort(vec, [](const Record& record) { return record.key; }, pool);
+    for (size_t i = 1; i < vec.Size(); ++i) {
+        ASSERT_LE(vec[i - 1].key, vec[i].key);
+        if (vec[i - 1].key == vec[i].key) {
+            ASSERT_LT(vec[i - 1].order, vec[i].order);
+        }
+    }
+}
+
+template <typename T>
+class SimdTest : public testing::Test {};
+
+using SimdTypes = testing::Types<int, float, double, int64_t>;
+TYPED_TEST_SUITE(SimdTest, SimdTypes);
+
+TYPED_TEST(SimdTest, KernelsMatchScalar) {
+    std::mt19937 mt(7);
+    for (size_t size : {0, 1, 5, 17, 100, 1001}) {
+        Vector<TypeParam> vec;
+        for (size_t i = 0; i < size; ++i) {
+            vec.PushBack(static_cast<TypeParam>(static_cast<int>(mt() % 50) - 25));
+        }
+        const TypeParam* data = vec.Data();
+        for (SimdLevel level = SimdLevel::SCALAR; level <= DetectSimdLevel();
+             level = static_cast<SimdLevel>(static_cast<int>(level) + 1)) {
+            for (TypeParam value : {TypeParam(-25), TypeParam(0), TypeParam(7), TypeParam(100)}) {
+                ASSERT_EQ(SimdFind(vec, value, level), std::find(data, data + size, value) - data);
+                ASSERT_EQ(SimdCount(vec, value, level), std::count(data, data + size, value));
+                ASSERT_EQ(SimdContains(vec, value, level), std::find(data, data + size, value) != data + size);
+            }
+            ASSERT_EQ(SimdSum(vec, level), std::accumulate(data, data + size, TypeParam{}));
+            if (size == 0) {
+                ASSERT_THROW(SimdMinMax(vec, level), std::out_of_range);
+            } else {
+                auto [min, max] = SimdMinMax(vec, level);
+                ASSERT_EQ(min, *std::min_element(data, data + size));
+                ASSERT_EQ(max, *std::max_element(data, data + size));
+            }
+        }
+    }
+}
+
+TEST(EmptyVectorTest, BoundsPolicies) {
+    Vector<int, std::allocator<int>, DoublingGrowth, UncheckedBounds> unchecked({1, 2, 3});
+    ASSERT_EQ(unchecked[2], 3);
+    ASSERT_THROW(unchecked.At(3), std::out_of_range) << "At must check bounds whatever the policy!";
+    Vector<int> checked({1, 2, 3});
+    ASSERT_THROW(checked[3], std::out_of_range);
+    ASSERT_EQ(checked.At(0), 1);
+    ParallelFill(unchecked, 5);
+    ASSERT_EQ(SimdSum(unchecked), 15);
+}
+
+TEST(EmptyVectorTest, SimdValueConvertsToElementType) {
+    Vector<double> vec({1.0, 5.0, 5.0});
+    ASSERT_EQ(SimdFind(vec, 5), 1);
+    ASSERT_EQ(SimdCount(vec, 5), 2);
+    ASSERT_FALSE(SimdContains(vec, 2));
+}
+
+TEST_F(VectorTest, EraseIf) {
+    ASSERT_EQ(vec.EraseIf([](int value) { return value % 2 == 0; }), 3);
+    std::vector<int> expected = {1, 3, 5, 7};
+    ASSERT_EQ(vec.Size(), expected.size());
+    for (size_t i = 0; i < vec.Size(); ++i) {
+        ASSERT_EQ(vec[i], expected[i]);
+    }
+    ASSERT_EQ(vec.Retain([](int value) { return value > 3; }), 2);
+    ASSERT_EQ(vec.Size(), 2);
+    ASSERT_EQ(vec[0], 5);
+    ASSERT_EQ(vec[1], 7);
+}
+
+TEST(EmptyVectorTest, EraseIfMoveOnly) {
+    Vector<std::unique_ptr<int>> vec;
+    for (int i = 0; i < 10; ++i) {
+        vec.PushBack(std::make_unique<int>(i));
+    }
+    vec.EraseIf([](const std::unique_ptr<int>& ptr) { return *ptr < 5; });
+    ASSERT_EQ(vec.Size(), 5);
+    for (size_t i = 0; i < vec.Size(); ++i) {
+        ASSERT_EQ(*vec[i], i + 5);
+    }
+}
+
+TEST_F(VectorTest, SwapErase) {
+    vec.SwapErase(1);
+    ASSERT_EQ(vec.Size(), sz - 1);
+    ASSERT_EQ(vec[1], 7);
+    vec.SwapErase(vec.Size() - 1);
+    ASSERT_EQ(vec.Size(), sz - 2);
+    ASSERT_EQ(vec.Back(), 5);
+    vec.SwapErase(sz); // no effect
+    ASSERT_EQ(vec.Size(), sz - 2);
+}
+
+TEST(MappedVectorTest, PersistsAcrossOpen) {
+    std::string path = (std::filesystem::temp_directory_path() / "mapped_vector_test.bin").string();
+    std::filesystem::remove(path);
+    {
+        MappedVector<int64_t> vec(path, MappedAccess::SEQUENTIAL);
+        ASSERT_TRUE(vec.IsEmpty());
+        for (int64_t i = 0; i < 100000; ++i) {
+            vec.PushBack(i);
+        }
+        vec.Resize(100010, -1);
+        ASSERT_GE(vec.Capacity(), vec.Size());
+    }
+    {
+        MappedVector<int64_t> vec(path);
+        ASSERT_EQ(vec.Size(), 100010);
+        for (int64_t i = 0; i < 100000; ++i) {
+            ASSERT_EQ(vec[i], i);
+        }
+        ASSERT_EQ(vec.Back(), -1);
+        vec.Advise(MappedAccess::RANDOM);
+        vec.Resize(5, 0);
+        int64_t tail[] = {7, 8, 9};
+        vec.Append(tail, 3);
+    }
+    MappedVector<int64_t> vec(path);
+    ASSERT_EQ(vec.Size(), 8);
+    ASSERT_EQ(vec[4], 4);
+    ASSERT_EQ(vec[7], 9);
+    ASSERT_THROW(vec[8], std::out_of_range);
+    vec.Front() = 10;
+    const auto& view = vec;
+    ASSERT_EQ(view.Front(), 10);
+    ASSERT_EQ(view.Back(), 9);
+    ASSERT_THROW(MappedVector<int32_t> other(path), std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+TEST(MappedVectorTest, SelfAppendAndMovedFrom) {
+    std::string path = (std::filesystem::temp_directory_path() / "mapped_vector_alias.bin").string();
+    std::filesystem::remove(path);
+    MappedVector<int64_t> vec(path);
+    for (int64_t i = 0; i < 10; ++i) {
+        vec.PushBack(i);
+    }
+    for (int round = 0; round < 12; ++round) {
+        vec.Append(vec.Data(), vec.Size());
+        vec.PushBack(vec[0]);
+    }
+    for (size_t i = 0; i < 10; ++i) {
+        ASSERT_EQ(vec[i], i);
+    }
+    ASSERT_EQ(vec.Back(), 0);
+    MappedVector<int64_t> moved(std::move(vec));
+    ASSERT_TRUE(vec.IsEmpty());
+    ASSERT_EQ(vec.Data(), nullptr);
+    vec.Clear();
+    vec.PopBack();
+    vec.Sync();
+    ASSERT_THROW(vec.PushBack(1), std::logic_error);
+    ASSERT_THROW(vec[0], std::out_of_range);
+    ASSERT_EQ(moved[9], 9);
+    std::filesystem::remove(path);
+}
+
+TEST_F(VectorTest, ResizeUninitializedAndZeroed) {
+    vec.ResizeUninitialized(sz + 3);
+    ASSERT_EQ(vec.Size(), sz + 3);
+    ASSERT_EQ(vec[sz - 1], 7);
+    vec.ResizeUninitialized(2);
+    vec.ResizeZeroed(100);
+    ASSERT_EQ(vec.Size(), 100);
+    ASSERT_EQ(vec[1], 2);
+    for (size_t i = 2; i < vec.Size(); ++i) {
+        ASSERT_EQ(vec[i], 0);
+    }
+}
+
+TEST(EmptyVectorTest, ResizeZeroedFromOs) {
+    Vector<int64_t, HugePageAllocator<int64_t>> vec;
+    vec.PushBack(42);
+    vec.ResizeZeroed(1 << 20);
+    ASSERT_EQ(vec[0], 42);
+    for (size_t i = 1; i < vec.Size(); ++i) {
+        ASSERT_EQ(vec[i], 0);
+    }
+    vec.ResizeZeroed(16);
+    vec.ResizeZeroed(1 << 19);
+    ASSERT_EQ(vec[(1 << 19) - 1], 0);
+}
+
+TEST(EmptyVectorTest, ReadFrom) {
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    int values[] = {1, 2, 3, 4, 5};
+    ASSERT_EQ(write(fds[1], values, sizeof(values)), sizeof(values));
+    close(fds[1]);
+    Vector<int> vec = {0};
+    ASSERT_EQ(vec.ReadFrom(fds[0], 3), 3);
+    ASSERT_EQ(vec.ReadFrom(fds[0], 10), 2);
+    ASSERT_EQ(vec.ReadFrom(fds[0], 10), 0);
+    close(fds[0]);
+    ASSERT_EQ(vec.Size(), 6);
+    for (size_t i = 0; i < vec.Size(); ++i) {
+        ASSERT_EQ(vec[i], i);
+    }
+}
+
+TEST(EmptyVectorTest, ReadFromTruncatedElement) {
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    int64_t values[] = {7, 8};
+    size_t bytes = sizeof(int64_t) + sizeof(int64_t) / 2;
+    ASSERT_EQ(write(fds[1], values, bytes), bytes);
+    close(fds[1]);
+    Vector<int64_t> vec;
+    ASSERT_THROW(vec.ReadFrom(fds[0], 2), std::runtime_error);
+    close(fds[0]);
+    ASSERT_EQ(vec.Size(), 1);
+    ASSERT_EQ(vec[0], 7);
+}
+
+TEST(SoAVectorTest, ColumnsStayAligned) {
+    SoAVector<int, double, std::string> vec;
+    vec.Reserve(16);
+    for (int i = 0; i < 10; ++i) {
+        vec.PushBack(i, i * 0.5, std::to_string(i));
+    }
+    vec.EmplaceBack(10, 5.0, "10");
+    ASSERT_EQ(vec.Size(), 11);
+    ASSERT_EQ(SimdSum(vec.Column<0>()), 55);
+    ASSERT_EQ(vec.Column<1>().Capacity(), 16);
+
+    vec.Erase(2, 4);
+    ASSERT_EQ(vec.Size(), 9);
+    ASSERT_EQ(vec.Get<0>(2), 4);
+    ASSERT_EQ(vec.Get<2>(2), "4");
+
+    vec.SwapErase(0);
+    auto [key, half, name] = vec[0];
+    ASSERT_EQ(key, 10);
+    ASSERT_EQ(half, 5.0);
+    ASSERT_EQ(name, "10");
+    std::get<0>(vec[1]) = 42;
+    ASSERT_EQ(vec.Data<0>()[1], 42);
+
+    vec.PopBack();
+    ASSERT_EQ(vec.Size(), 7);
+    ASSERT_THROW(vec.Get<1>(7), std::out_of_range);
+    vec.Clear();
+    ASSERT_TRUE(vec.IsEmpty());
+}
+
+TEST(SoAVectorTest, ThrowingColumnKeepsLengths) {
+    struct NonNegative {
+        explicit NonNegative(int v) : value(v) {
+            if (v < 0) {
+                throw std::invalid_argument("negative");
+            }
+        }
+        int value;
+    };
+    SoAVector<int, std::string, NonNegative> vec;
+    vec.EmplaceBack(1, "one", 1);
+    ASSERT_THROW(vec.EmplaceBack(2, "two", -2), std::invalid_argument);
+    ASSERT_EQ(vec.Size(), 1);
+    ASSERT_EQ(vec.Column<1>().Size(), 1);
+    ASSERT_EQ(vec.Column<2>().Size(), 1);
+    vec.EmplaceBack(3, "three", 3);
+    ASSERT_EQ(vec.Get<1>(1), "three");
+    ASSERT_EQ(vec.Get<2>(1).value, 3);
+}
+
 TEST_F(VectorTest, CopyConstructor) {
     Vector<int> vec1 = vec;
     ASSERT_NE(&vec1, &vec) << "Copy constructor must do copy!\n";
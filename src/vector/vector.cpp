@@ -1,11 +1,11 @@
 #include "vector.hpp"
 
-template <typename T, typename Alloc>
-Vector<T, Alloc>::Vector() : data_(nullptr), size_(0), capacity_(0) {
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::Vector() : data_(nullptr), size_(0), capacity_(0) {
 }
 
-template <typename T, typename Alloc>
-Vector<T, Alloc>::Vector(size_t count, const T& value) : Vector() {
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::Vector(size_t count, const T& value) : Vector() {
     Reserve(count);
     for (size_t i = 0; i < count; ++i) {
         std::allocator_traits<Alloc>::construct(allocator_, data_ + i, value);
@@ -13,8 +13,8 @@ Vector<T, Alloc>::Vector(size_t count, const T& value) : Vector() {
     size_ = count;
 }
 
-template <typename T, typename Alloc>
-Vector<T, Alloc>::Vector(const Vector& other) : Vector() {
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::Vector(const Vector& other) : Vector() {
     Reserve(other.size_);
     for (size_t i = 0; i < other.size_; ++i) {
         std::allocator_traits<Alloc>::construct(allocator_, data_ + i, other.data_[i]);
@@ -22,19 +22,22 @@ Vector<T, Alloc>::Vector(const Vector& other) : Vector() {
     size_ = other.size_;
 }
 
-template <typename T, typename Alloc>
-Vector<T, Alloc>& Vector<T, Alloc>::operator=(const Vector& other) {
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+Vector<T, Alloc, GrowthPolicy, BoundsPolicy>& Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::operator=(const Vector& other) {
     if (this != &other) {
-        Vector<T> temp(other);
+        Vector temp(other);
         *this = std::move(temp);
     }
     return *this;
 }
 
-template <typename T, typename Alloc>
-Vector<T, Alloc>& Vector<T, Alloc>::operator=(Vector&& other) {
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+Vector<T, Alloc, GrowthPolicy, BoundsPolicy>& Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::operator=(Vector&& other) {
     if (this != &other) {
         Clear();
+        if (data_) {
+            allocator_.deallocate(data_, capacity_);
+        }
         data_ = other.data_;
         size_ = other.size_;
         capacity_ = other.capacity_;
@@ -45,13 +48,13 @@ Vector<T, Alloc>& Vector<T, Alloc>::operator=(Vector&& other) {
     return *this;
 }
 
-template <typename T, typename Alloc>
-Vector<T, Alloc>::Vector(Vector&& other) noexcept : Vector() {
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::Vector(Vector&& other) noexcept : Vector() {
     *this = std::move(other);
 }
 
-template <typename T, typename Alloc>
-Vector<T, Alloc>::Vector(std::initializer_list<T> init) : Vector() {
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::Vector(std::initializer_list<T> init) : Vector() {
     Reserve(init.size());
     auto it = init.begin();
     for (size_t i = 0; i < init.size(); ++i) {
@@ -60,55 +63,69 @@ Vector<T, Alloc>::Vector(std::initializer_list<T> init) : Vector() {
     size_ = init.size();
 }
 
-template <typename T, typename Alloc>
-T& Vector<T, Alloc>::operator[](size_t pos) {
-    if (pos >= size_) {
-        throw std::out_of_range("Vector access out of range");
-    }
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+T& Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::operator[](size_t pos) {
+    BoundsPolicy::Check(pos, size_, "Vector access out of range");
     return data_[pos];
 }
 
-template <typename T, typename Alloc>
-bool Vector<T, Alloc>::IsEmpty() const noexcept {
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+T& Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::At(size_t pos) {
+    CheckedBounds::Check(pos, size_, "Vector access out of range");
+    return data_[pos];
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+const T& Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::At(size_t pos) const {
+    CheckedBounds::Check(pos, size_, "Vector access out of range");
+    return data_[pos];
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+bool Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::IsEmpty() const noexcept {
     return size_ == 0;
 }
 
-template <typename T, typename Alloc>
-const T& Vector<T, Alloc>::Front() const noexcept {
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+const T& Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::Front() const noexcept {
     return data_[0];
 }
 
-template <typename T, typename Alloc>
-T& Vector<T, Alloc>::Back() const noexcept {
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+T& Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::Back() const noexcept {
     return data_[size_ - 1];
 }
 
-template <typename T, typename Alloc>
-T* Vector<T, Alloc>::Data() const noexcept {
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+T* Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::Data() const noexcept {
     return data_;
 }
 
-template <typename T, typename Alloc>
-size_t Vector<T, Alloc>::Size() const noexcept {
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+size_t Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::Size() const noexcept {
     return size_;
 }
 
-template <typename T, typename Alloc>
-size_t Vector<T, Alloc>::Capacity() const noexcept {
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+size_t Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::Capacity() const noexcept {
     return capacity_;
 }
 
-template <typename T, typename Alloc>
-void Vector<T, Alloc>::Reserve(size_t new_cap) {
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+void Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::Reserve(size_t new_cap) {
     if (new_cap > capacity_ || capacity_ == 0) {
         if (new_cap < CAPACITY) {
             new_cap = CAPACITY;
         }
-        T* new_data = allocator_.allocate(new_cap);
-        for (size_t i = 0; i < size_; ++i) {
-            std::allocator_traits<Alloc>::construct(allocator_, new_data + i, std::move(data_[i]));
-            std::allocator_traits<Alloc>::destroy(allocator_, data_ + i);
+        if constexpr (HasReallocate<Alloc, T>::value && IsTriviallyRelocatable<T>::value) {
+            if (data_) {
+                data_ = allocator_.reallocate(data_, capacity_, new_cap, size_);
+                capacity_ = new_cap;
+                return;
+            }
         }
+        T* new_data = allocator_.allocate(new_cap);
+        RelocateElements(allocator_, new_data, data_, size_);
         if (data_) {
             allocator_.deallocate(data_, capacity_);
         }
@@ -117,79 +134,187 @@ void Vector<T, Alloc>::Reserve(size_t new_cap) {
     }
 }
 
-template <typename T, typename Alloc>
-void Vector<T, Alloc>::Clear() noexcept {
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+void Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::Clear() noexcept {
     for (size_t i = 0; i < size_; ++i) {
         std::allocator_traits<Alloc>::destroy(allocator_, data_ + i);
     }
-    if (data_) {
-        allocator_.deallocate(data_, capacity_);
-    }
-    data_ = nullptr;
     size_ = 0;
 }
 
-template <typename T, typename Alloc>
-void Vector<T, Alloc>::Insert(size_t pos, T value) {
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+void Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::Insert(size_t pos, T value) {
+    if (pos > size_) {
+        throw std::out_of_range("Vector insert out of range");
+    }
     if (size_ >= capacity_) {
-        Reserve((capacity_ == 0) ? 1 : 2 * capacity_);
+        Grow(size_ + 1);
     }
     if (pos < size_) {
-        for (size_t i = size_; i > pos; --i) {
-            std::allocator_traits<Alloc>::construct(allocator_, data_ + i, std::move(data_[i - 1]));
-            std::allocator_traits<Alloc>::destroy(allocator_, data_ + i - 1);
-        }
+        RelocateElements(allocator_, data_ + pos + 1, data_ + pos, size_ - pos);
     }
     std::allocator_traits<Alloc>::construct(allocator_, data_ + pos, std::move(value));
     ++size_;
 }
 
-template <typename T, typename Alloc>
-void Vector<T, Alloc>::Erase(size_t begin_pos, size_t end_pos) {
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+void Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::Erase(size_t begin_pos, size_t end_pos) {
     if (begin_pos >= size_ || begin_pos >= end_pos) {
         return;
     }
     end_pos = std::min(end_pos, size_);
     size_t num_to_remove = end_pos - begin_pos;
-    for (size_t i = begin_pos; i < size_ - num_to_remove; ++i) {
+    for (size_t i = begin_pos; i < end_pos; ++i) {
         std::allocator_traits<Alloc>::destroy(allocator_, data_ + i);
-        std::allocator_traits<Alloc>::construct(allocator_, data_ + i, std::move(data_[i + num_to_remove]));
     }
-    for (size_t i = size_ - num_to_remove; i < size_; ++i) {
+    RelocateElements(allocator_, data_ + begin_pos, data_ + end_pos, size_ - end_pos);
+    size_ -= num_to_remove;
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+template <class Predicate>
+size_t Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::EraseIf(Predicate pred) {
+    size_t kept = 0;
+    for (size_t i = 0; i < size_; ++i) {
+        if (!pred(data_[i])) {
+            if (kept != i) {
+                data_[kept] = std::move(data_[i]);
+            }
+            ++kept;
+        }
+    }
+    size_t removed = size_ - kept;
+    for (size_t i = kept; i < size_; ++i) {
         std::allocator_traits<Alloc>::destroy(allocator_, data_ + i);
     }
-    size_ -= num_to_remove;
+    size_ = kept;
+    return removed;
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+template <class Predicate>
+size_t Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::Retain(Predicate pred) {
+    return EraseIf([&pred](const T& value) { return !pred(value); });
 }
 
-template <typename T, typename Alloc>
-void Vector<T, Alloc>::PushBack(T value) {
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+void Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::SwapErase(size_t pos) {
+    if (pos >= size_) {
+        return;
+    }
+    if (pos != size_ - 1) {
+        data_[pos] = std::move(data_[size_ - 1]);
+    }
+    PopBack();
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+template <class InputIt>
+void Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::InsertRange(size_t pos, InputIt first, InputIt last) {
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (!std::is_base_of_v<std::forward_iterator_tag, Category>) {
+        Vector buffer;
+        for (; first != last; ++first) {
+            buffer.EmplaceBack(*first);
+        }
+        InsertRange(pos, std::make_move_iterator(buffer.data_), std::make_move_iterator(buffer.data_ + buffer.size_));
+    } else {
+        if (pos > size_) {
+            throw std::out_of_range("Vector insert out of range");
+        }
+        size_t count = std::distance(first, last);
+        if (count == 0) {
+            return;
+        }
+        if constexpr (std::is_pointer_v<InputIt>) {
+            if (first >= data_ && first < data_ + size_) {
+                Vector buffer;
+                buffer.Append(first, last);
+                InsertRange(pos, std::make_move_iterator(buffer.data_),
+                            std::make_move_iterator(buffer.data_ + buffer.size_));
+                return;
+            }
+        }
+        Grow(size_ + count);
+        RelocateElements(allocator_, data_ + pos + count, data_ + pos, size_ - pos);
+        using Source = std::remove_cv_t<std::remove_pointer_t<InputIt>>;
+        if constexpr (std::is_pointer_v<InputIt> && std::is_same_v<Source, T> && std::is_trivially_copyable_v<T>) {
+            std::memcpy(static_cast<void*>(data_ + pos), static_cast<const void*>(first), count * sizeof(T));
+        } else {
+            size_t built = 0;
+            try {
+                for (; built < count; ++built, ++first) {
+                    std::allocator_traits<Alloc>::construct(allocator_, data_ + pos + built, *first);
+                }
+            } catch (...) {
+                for (size_t i = 0; i < built; ++i) {
+                    std::allocator_traits<Alloc>::destroy(allocator_, data_ + pos + i);
+                }
+                RelocateElements(allocator_, data_ + pos, data_ + pos + count, size_ - pos);
+                throw;
+            }
+        }
+        size_ += count;
+    }
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+void Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::PushBack(T value) {
     Insert(size_, std::move(value));
 }
 
-template <typename T, typename Alloc>
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+template <class InputIt>
+void Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::Append(InputIt first, InputIt last) {
+    InsertRange(size_, first, last);
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+void Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::Append(const T* values, size_t count) {
+    InsertRange(size_, values, values + count);
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+void Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::AppendFrom(Vector&& other) {
+    if (this == &other || other.size_ == 0) {
+        return;
+    }
+    if (size_ == 0 && other.capacity_ >= capacity_) {
+        *this = std::move(other);
+        return;
+    }
+    Grow(size_ + other.size_);
+    RelocateElements(allocator_, data_ + size_, other.data_, other.size_);
+    size_ += other.size_;
+    other.size_ = 0;
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
 template <class... Args>
-void Vector<T, Alloc>::EmplaceBack(Args&&... args) {
-    Reserve(size_ + 1);
+void Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::EmplaceBack(Args&&... args) {
+    if (size_ >= capacity_) {
+        Grow(size_ + 1);
+    }
     std::allocator_traits<Alloc>::construct(allocator_, data_ + size_, std::forward<Args>(args)...);
     ++size_;
 }
 
-template <typename T, typename Alloc>
-void Vector<T, Alloc>::PopBack() {
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+void Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::PopBack() {
     if (size_ > 0) {
         std::allocator_traits<Alloc>::destroy(allocator_, data_ + --size_);
     }
 }
 
-template <typename T, typename Alloc>
-void Vector<T, Alloc>::Resize(size_t count, const T& value) {
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+void Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::Resize(size_t count, const T& value) {
     if (count < size_) {
         for (size_t i = count; i < size_; ++i) {
             std::allocator_traits<Alloc>::destroy(allocator_, data_ + i);
         }
         size_ = count;
     } else if (count > size_) {
-        Reserve(count);
+        Grow(count);
         for (size_t i = size_; i < count; ++i) {
             std::allocator_traits<Alloc>::construct(allocator_, data_ + i, value);
         }
@@ -197,48 +322,158 @@ void Vector<T, Alloc>::Resize(size_t count, const T& value) {
     }
 }
 
-template <typename T, typename Alloc>
-Vector<T, Alloc>::~Vector() {
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+void Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::ResizeUninitialized(size_t count) {
+    static_assert(std::is_trivial_v<T>, "Uninitialized elements are only allowed for trivial types");
+    if (count > size_) {
+        Grow(count);
+    }
+    size_ = count;
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+void Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::ResizeZeroed(size_t count) {
+    static_assert(std::is_trivial_v<T>, "Zero-filled elements are only allowed for trivial types");
+    if (count <= size_) {
+        size_ = count;
+        return;
+    }
+    if constexpr (HasAllocateZeroed<Alloc>::value) {
+        if (count > capacity_) {
+            size_t new_cap = std::max(GrowthPolicy::NextCapacity(capacity_, count, sizeof(T)), CAPACITY);
+            T* new_data = allocator_.allocate_zeroed(new_cap);
+            RelocateElements(allocator_, new_data, data_, size_);
+            if (data_) {
+                allocator_.deallocate(data_, capacity_);
+            }
+            data_ = new_data;
+            capacity_ = new_cap;
+            size_ = count;
+            return;
+        }
+    }
+    Grow(count);
+    std::memset(static_cast<void*>(data_ + size_), 0, (count - size_) * sizeof(T));
+    size_ = count;
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+size_t Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::ReadFrom(int fd, size_t count) {
+    static_assert(std::is_trivially_copyable_v<T>, "ReadFrom fills elements with raw bytes");
+    Grow(size_ + count);
+    char* tail = reinterpret_cast<char*>(data_ + size_);
+    size_t want = count * sizeof(T);
+    size_t got = 0;
+    while (got < want) {
+        ssize_t bytes = read(fd, tail + got, want - got);
+        if (bytes < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::system_error(errno, std::generic_category(), "Vector read");
+        }
+        if (bytes == 0) {
+            break;
+        }
+        got += static_cast<size_t>(bytes);
+    }
+    size_ += got / sizeof(T);
+    if (got % sizeof(T) != 0) {
+        throw std::runtime_error("truncated element");
+    }
+    return got / sizeof(T);
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+void Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::Grow(size_t required) {
+    if (required > capacity_) {
+        Reserve(GrowthPolicy::NextCapacity(capacity_, required, sizeof(T)));
+    }
+}
+
+template <typename T, typename Alloc, typename GrowthPolicy, typename BoundsPolicy>
+Vector<T, Alloc, GrowthPolicy, BoundsPolicy>::~Vector() {
     Clear();
+    if (data_) {
+        allocator_.deallocate(data_, capacity_);
+    }
 }
 
+// Owns a set of blobs. Blobs handed in through PushBack are malloc'd by the caller and
+// freed one by one. Blobs from Allocate are carved from shared slabs by power-of-two
+// size class and tagged with that class in the low pointer bits, so the whole set is
+// released slab by slab and a recycled blob goes to the free list of its class.
 template <>
 class Vector<void*> {
 public:
-    Vector() : data_(nullptr), size_(0), capacity_(0) {
+    static constexpr size_t SLAB_SIZE = 1 << 16;
+    static constexpr size_t MIN_BLOB_SIZE = 16;
+    static constexpr size_t SIZE_CLASSES = 8;
+    static constexpr size_t MAX_BLOB_SIZE = MIN_BLOB_SIZE << (SIZE_CLASSES - 1);
+
+    static_assert(alignof(std::max_align_t) >= MIN_BLOB_SIZE, "malloc'd blobs must leave the tag bits free");
+
+    Vector()
+        : data_(nullptr),
+          size_(0),
+          capacity_(0),
+          foreign_count_(0),
+          slabs_(nullptr),
+          slab_count_(0),
+          slab_capacity_(0),
+          slab_cursor_(nullptr),
+          slab_end_(nullptr),
+          free_lists_() {
     }
 
-    Vector& operator=(const Vector& other) {
-        Reserve(other.size_);
-        Clear();
-        for (size_t index = 0; index < other.size_; ++index) {
-            data_[index] = other.data_[index];
-        }
-        return *this;
+    Vector(const Vector& other) = delete;
+
+    Vector& operator=(const Vector& other) = delete;
+
+    Vector(Vector&& other) noexcept : Vector() {
+        *this = std::move(other);
     }
 
-    Vector& operator=(Vector&& other) {
+    Vector& operator=(Vector&& other) noexcept {
         Clear();
         std::swap(data_, other.data_);
         std::swap(size_, other.size_);
         std::swap(capacity_, other.capacity_);
+        std::swap(foreign_count_, other.foreign_count_);
+        std::swap(slabs_, other.slabs_);
+        std::swap(slab_count_, other.slab_count_);
+        std::swap(slab_capacity_, other.slab_capacity_);
+        std::swap(slab_cursor_, other.slab_cursor_);
+        std::swap(slab_end_, other.slab_end_);
+        std::swap(free_lists_, other.free_lists_);
         return *this;
     }
 
+    void* operator[](size_t pos) const {
+        if (pos >= size_) {
+            throw std::out_of_range("Vector access out of range");
+        }
+        return Untag(data_[pos]);
+    }
+
     size_t Size() const noexcept {
         return size_;
     }
 
+    size_t SlabCount() const noexcept {
+        return slab_count_;
+    }
+
     bool IsEmpty() const noexcept {
         return size_ == 0;
     }
 
     void* Front() const {
-        return data_[0];
+        return Untag(data_[0]);
     }
 
     void* Back() const {
-        return data_[size_ - 1];
+        return Untag(data_[size_ - 1]);
     }
 
     void Reserve(size_t new_size) {
@@ -246,6 +481,9 @@ public:
             return;
         }
         void** new_data = static_cast<void**>(malloc(new_size * sizeof(void*)));
+        if (!new_data) {
+            throw std::bad_alloc();
+        }
         for (size_t index = 0; index < size_; ++index) {
             new (new_data + index) void*(data_[index]);
         }
@@ -255,29 +493,143 @@ public:
     }
 
     void PushBack(void* value) {
-        if (size_ == capacity_) {
-            Reserve((capacity_ == 0) ? 1 : 2 * capacity_);
+        Append(value);
+        if (value) {
+            ++foreign_count_;
+        }
+    }
+
+    void* Allocate(size_t bytes) {
+        if (bytes > MAX_BLOB_SIZE) {
+            void* blob = malloc(bytes);
+            if (!blob) {
+                throw std::bad_alloc();
+            }
+            try {
+                PushBack(blob);
+            } catch (...) {
+                free(blob);
+                throw;
+            }
+            return blob;
+        }
+        size_t size_class = SizeClass(bytes);
+        void* blob = free_lists_[size_class];
+        if (blob) {
+            free_lists_[size_class] = *static_cast<void**>(blob);
+        } else {
+            blob = Carve(MIN_BLOB_SIZE << size_class);
+        }
+        Append(reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(blob) | (size_class + 1)));
+        return blob;
+    }
+
+    // Frees the blob at pos and leaves a vacant slot that reads as nullptr, so the
+    // positions of later blobs do not change. Vacant slots at the end are dropped.
+    void Recycle(size_t pos) {
+        if (pos >= size_) {
+            throw std::out_of_range("Vector access out of range");
+        }
+        void* entry = data_[pos];
+        uintptr_t tag = reinterpret_cast<uintptr_t>(entry) & TAG_MASK;
+        if (tag == VACANT) {
+            return;
+        }
+        data_[pos] = reinterpret_cast<void*>(VACANT);
+        while (size_ > 0 && data_[size_ - 1] == reinterpret_cast<void*>(VACANT)) {
+            --size_;
+        }
+        if (tag) {
+            void* blob = Untag(entry);
+            *static_cast<void**>(blob) = free_lists_[tag - 1];
+            free_lists_[tag - 1] = blob;
+        } else if (entry) {
+            free(entry);
+            --foreign_count_;
         }
-        data_[size_] = value;
-        ++size_;
     }
 
     void Clear() noexcept {
-        for (size_t index = 0; index < size_; ++index) {
-            if (data_[index]) {
+        for (size_t index = 0; foreign_count_ > 0 && index < size_; ++index) {
+            if (data_[index] && !(reinterpret_cast<uintptr_t>(data_[index]) & TAG_MASK)) {
                 free(data_[index]);
+                --foreign_count_;
             }
         }
+        for (size_t index = 0; index < slab_count_; ++index) {
+            free(slabs_[index]);
+        }
+        slab_count_ = 0;
+        slab_cursor_ = nullptr;
+        slab_end_ = nullptr;
+        std::fill(std::begin(free_lists_), std::end(free_lists_), nullptr);
         size_ = 0;
     }
 
     ~Vector() noexcept {
         Clear();
         free(data_);
+        free(slabs_);
     }
 
 private:
+    static constexpr uintptr_t TAG_MASK = MIN_BLOB_SIZE - 1;
+    static constexpr uintptr_t VACANT = TAG_MASK;
+
+    static_assert(SIZE_CLASSES < VACANT, "The vacant tag must not collide with a size class");
+
+    static void* Untag(void* entry) noexcept {
+        return reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(entry) & ~TAG_MASK);
+    }
+
+    static size_t SizeClass(size_t bytes) noexcept {
+        size_t size_class = 0;
+        while ((MIN_BLOB_SIZE << size_class) < bytes) {
+            ++size_class;
+        }
+        return size_class;
+    }
+
+    void Append(void* entry) {
+        if (size_ == capacity_) {
+            Reserve((capacity_ == 0) ? 1 : 2 * capacity_);
+        }
+        data_[size_] = entry;
+        ++size_;
+    }
+
+    void* Carve(size_t bytes) {
+        if (static_cast<size_t>(slab_end_ - slab_cursor_) < bytes) {
+            if (slab_count_ == slab_capacity_) {
+                size_t new_capacity = (slab_capacity_ == 0) ? 4 : 2 * slab_capacity_;
+                void** new_slabs = static_cast<void**>(realloc(slabs_, new_capacity * sizeof(void*)));
+                if (!new_slabs) {
+                    throw std::bad_alloc();
+                }
+                slabs_ = new_slabs;
+                slab_capacity_ = new_capacity;
+            }
+            char* slab = static_cast<char*>(aligned_alloc(MIN_BLOB_SIZE, SLAB_SIZE));
+            if (!slab) {
+                throw std::bad_alloc();
+            }
+            slab_cursor_ = slab;
+            slab_end_ = slab_cursor_ + SLAB_SIZE;
+            slabs_[slab_count_++] = slab_cursor_;
+        }
+        void* blob = slab_cursor_;
+        slab_cursor_ += bytes;
+        return blob;
+    }
+
     void** data_;
     size_t size_;
     size_t capacity_;
-};
\ No newline at end of file
+    size_t foreign_count_;
+    void** slabs_;
+    size_t slab_count_;
+    size_t slab_capacity_;
+    char* slab_cursor_;
+    char* slab_end_;
+    void* free_lists_[SIZE_CLASSES];
+};
@@ -1,12 +1,111 @@
 #pragma once
 
 #include <algorithm>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <initializer_list>
 #include <iostream>
+#include <iterator>
 #include <memory>
 #include <stdexcept>
-
-template <typename T, typename Alloc = std::allocator<T>>
+#include <system_error>
+#include <type_traits>
+
+#include "../common/bounds_policy.hpp"
+
+// Types that can be moved to a new address with a plain memcpy and no destructor
+// call on the source. Specialize it for types owning resources through a stable handle.
+template <typename T>
+struct IsTriviallyRelocatable : std::is_trivially_copyable<T> {};
+
+// Allocators exposing reallocate(p, old_n, new_n, live_n) can grow a buffer of trivially
+// relocatable elements in place instead of copying it; live_n elements hold data.
+template <typename Alloc, typename T, typename = void>
+struct HasReallocate : std::false_type {};
+
+template <typename Alloc, typename T>
+struct HasReallocate<Alloc, T,
+                     std::void_t<decltype(std::declval<Alloc&>().reallocate(std::declval<T*>(), size_t{},
+                                                                            size_t{}, size_t{}))>> : std::true_type {};
+
+// Allocators exposing allocate_zeroed(n) hand out memory the OS has already zeroed
+// (calloc, fresh anonymous mappings), so zero-filled growth needs no memset.
+template <typename Alloc, typename = void>
+struct HasAllocateZeroed : std::false_type {};
+
+template <typename Alloc>
+struct HasAllocateZeroed<Alloc, std::void_t<decltype(std::declval<Alloc&>().allocate_zeroed(size_t{}))>>
+    : std::true_type {};
+
+// Moves count elements from src to dst, destroying the sources. The ranges may overlap;
+// trivially relocatable types go through a single memmove.
+template <typename Alloc, typename T>
+void RelocateElements(Alloc& allocator, T* dst, T* src, size_t count) {
+    if (count == 0 || dst == src) {
+        return;
+    }
+    if constexpr (IsTriviallyRelocatable<T>::value) {
+        std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), count * sizeof(T));
+    } else if (dst < src) {
+        for (size_t i = 0; i < count; ++i) {
+            std::allocator_traits<Alloc>::construct(allocator, dst + i, std::move(src[i]));
+            std::allocator_traits<Alloc>::destroy(allocator, src + i);
+        }
+    } else {
+        for (size_t i = count; i > 0; --i) {
+            std::allocator_traits<Alloc>::construct(allocator, dst + i - 1, std::move(src[i - 1]));
+            std::allocator_traits<Alloc>::destroy(allocator, src + i - 1);
+        }
+    }
+}
+
+struct DoublingGrowth {
+    static size_t NextCapacity(size_t capacity, size_t required, size_t /*elem_size*/) noexcept {
+        return std::max(required, 2 * capacity);
+    }
+};
+
+struct OneAndHalfGrowth {
+    static size_t NextCapacity(size_t capacity, size_t required, size_t /*elem_size*/) noexcept {
+        return std::max(required, capacity + capacity / 2);
+    }
+};
+
+// Doubles and then rounds the buffer up to the allocator size class: a power of two
+// for small blocks and a whole number of pages for large ones, so no slack is wasted.
+struct SizeClassGrowth {
+    static constexpr size_t PAGE_SIZE = 4096;
+
+    static size_t NextCapacity(size_t capacity, size_t required, size_t elem_size) noexcept {
+        size_t bytes = std::max(required, 2 * capacity) * elem_size;
+        if (bytes <= PAGE_SIZE) {
+            size_t size_class = 16;
+            while (size_class < bytes) {
+                size_class *= 2;
+            }
+            bytes = size_class;
+        } else {
+            bytes = (bytes + PAGE_SIZE - 1) / PAGE_SIZE * PAGE_SIZE;
+        }
+        return std::max(required, bytes / elem_size);
+    }
+};
+
+template <size_t Step>
+struct FixedStepGrowth {
+    static_assert(Step > 0, "Growth step must be positive");
+
+    static size_t NextCapacity(size_t capacity, size_t required, size_t /*elem_size*/) noexcept {
+        return std::max(required, capacity + Step);
+    }
+};
+
+template <typename T, typename Alloc = std::allocator<T>, typename GrowthPolicy = DoublingGrowth,
+          typename BoundsPolicy = CheckedBounds>
 class Vector {
 public:
     const size_t CAPACITY = 10;
@@ -27,6 +126,10 @@ public:
 
     T& operator[](size_t pos);
 
+    T& At(size_t pos);
+
+    const T& At(size_t pos) const;
+
     const T& Front() const noexcept;
 
     T& Back() const noexcept;
@@ -47,8 +150,26 @@ public:
 
     void Erase(size_t begin_pos, size_t end_pos);
 
+    template <class Predicate>
+    size_t EraseIf(Predicate pred);
+
+    template <class Predicate>
+    size_t Retain(Predicate pred);
+
+    void SwapErase(size_t pos);
+
+    template <class InputIt>
+    void InsertRange(size_t pos, InputIt first, InputIt last);
+
     void PushBack(T value);
 
+    template <class InputIt>
+    void Append(InputIt first, InputIt last);
+
+    void Append(const T* values, size_t count);
+
+    void AppendFrom(Vector&& other);
+
     template <class... Args>
     void EmplaceBack(Args&&... args);
 
@@ -56,9 +177,23 @@ public:
 
     void Resize(size_t count, const T& value);
 
+    // Grows without initializing the new elements; they must be written before being read.
+    void ResizeUninitialized(size_t count);
+
+    // Grows with zeroed elements. Allocators with allocate_zeroed (e.g. calloc-backed ones) get
+    // the zeroes for free on reallocation; with the default allocator this is Grow plus memset.
+    void ResizeZeroed(size_t count);
+
+    // Reads up to count elements from fd into the tail and returns how many were read. Throws
+    // std::runtime_error if the stream ends in the middle of an element; the whole elements
+    // before it are kept.
+    size_t ReadFrom(int fd, size_t count);
+
     ~Vector();
 
 private:
+    void Grow(size_t required);
+
     Alloc allocator_;
     T* data_;
     size_t size_;